@@ -0,0 +1,46 @@
+// Compares two benchmark reports, such as one from the distributable build and one from `npm run build:host`.
+//
+// Usage: npm run bench:compare -- <baseline.json> <candidate.json>
+//   Both reports are written by `npm run bench -- --output=<file>`. For every operation measured in both,
+//   prints the throughput of each and the speedup of the candidate over the baseline.
+
+const fs = require("fs");
+
+const log = (...parts) => process.stdout.write(parts.join(" ") + "\n");
+
+const describeBuild = ({meta}) => meta.build
+  ? `liboqs ${meta.build.liboqsVersion}, ${meta.build.hostTuned ? "host-tuned" : "distributable"}`
+  : "unknown build";
+
+function compareKind(kind, baseline, candidate) {
+  for (const [algorithm, base] of Object.entries(baseline)) {
+    const cand = candidate[algorithm];
+    if (!cand) {
+      continue;
+    }
+    log(`${kind} ${algorithm} (${base.implementation || "?"} -> ${cand.implementation || "?"})`);
+    for (const [name, baseResult] of Object.entries(base.operations)) {
+      const candResult = cand.operations[name];
+      if (!candResult) {
+        continue;
+      }
+      const speedup = candResult.opsPerSec / baseResult.opsPerSec;
+      log(`  ${name.padEnd(28)} ${baseResult.opsPerSec.toFixed(1).padStart(12)} -> ${candResult.opsPerSec.toFixed(1).padStart(12)} ops/s  x${speedup.toFixed(2)}`);
+    }
+  }
+}
+
+function main() {
+  const [baselinePath, candidatePath] = process.argv.slice(2);
+  if (!baselinePath || !candidatePath) {
+    throw new Error("Usage: compare.js <baseline.json> <candidate.json>");
+  }
+  const baseline = JSON.parse(fs.readFileSync(baselinePath, "utf8"));
+  const candidate = JSON.parse(fs.readFileSync(candidatePath, "utf8"));
+  log(`Baseline:  ${describeBuild(baseline)}`);
+  log(`Candidate: ${describeBuild(candidate)}`);
+  compareKind("KEM", baseline.kems, candidate.kems);
+  compareKind("Signature", baseline.sigs, candidate.sigs);
+}
+
+main();
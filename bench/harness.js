@@ -0,0 +1,82 @@
+const now = () => process.hrtime.bigint();
+
+const nsToUs = (ns) => Number(ns) / 1e3;
+
+/**
+ * Summarizes per-operation latencies (in nanoseconds) taken over `elapsedNs`.
+ */
+function summarize(latencies, elapsedNs) {
+  const sorted = BigUint64Array.from(latencies).sort();
+  const percentile = (p) => nsToUs(sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))]);
+  const total = latencies.reduce((sum, latency) => sum + latency, 0n);
+  return {
+    iterations: latencies.length,
+    opsPerSec: latencies.length / (Number(elapsedNs) / 1e9),
+    latencyUs: {
+      mean: nsToUs(total) / latencies.length,
+      p50: percentile(0.5),
+      p90: percentile(0.9),
+      p99: percentile(0.99),
+      max: nsToUs(sorted[sorted.length - 1])
+    }
+  };
+}
+
+/**
+ * Runs `fn` repeatedly until at least `minTimeMs` has passed and `minIterations` calls have been made.
+ * `setup`, if given, is called before each call and its result passed to `fn`, outside of the timing.
+ */
+function measureSync(fn, {minTimeMs, minIterations, warmup, setup}) {
+  for (let i = 0; i < warmup; i++) {
+    fn(setup ? setup() : undefined);
+  }
+  const latencies = [];
+  let elapsed = 0n;
+  const minTime = BigInt(minTimeMs) * 1000000n;
+  while (elapsed < minTime || latencies.length < minIterations) {
+    const input = setup ? setup() : undefined;
+    const start = now();
+    fn(input);
+    const latency = now() - start;
+    latencies.push(latency);
+    elapsed += latency;
+  }
+  return summarize(latencies, elapsed);
+}
+
+/**
+ * Like measureSync, but for a function returning a Promise.
+ * Keeps `concurrency` calls in flight, so ops/sec reflects throughput while latency includes queueing.
+ */
+async function measureAsync(fn, {minTimeMs, minIterations, warmup, setup, concurrency}) {
+  for (let i = 0; i < warmup; i++) {
+    await fn(setup ? setup() : undefined);
+  }
+  const latencies = [];
+  const minTime = BigInt(minTimeMs) * 1000000n;
+  const start = now();
+  const runOne = async () => {
+    while (now() - start < minTime || latencies.length < minIterations) {
+      const input = setup ? setup() : undefined;
+      const opStart = now();
+      await fn(input);
+      latencies.push(now() - opStart);
+    }
+  };
+  await Promise.all(Array.from({length: concurrency}, runOne));
+  return summarize(latencies, now() - start);
+}
+
+/**
+ * Gets the memory usage of the process in bytes.
+ */
+function memory() {
+  const {rss, heapUsed, external, arrayBuffers} = process.memoryUsage();
+  return {rss, heapUsed, external, arrayBuffers};
+}
+
+module.exports = {
+  measureSync,
+  measureAsync,
+  memory
+};
@@ -0,0 +1,232 @@
+// Benchmarks every enabled algorithm.
+//
+// Usage: npm run bench -- [options]
+//   --filter=<text>      Only benchmark algorithms whose name contains <text>
+//   --time=<ms>          Minimum time spent on each operation (default 500)
+//   --iterations=<n>     Minimum number of calls of each operation (default 5)
+//   --sizes=<n,...>      Message sizes in bytes for sign/verify (default 32,1024,65536)
+//   --concurrency=<n>    Calls kept in flight for async operations (default: number of CPUs)
+//   --no-async           Skip the async variants
+//   --json               Print the results as JSON to stdout
+//   --output=<file>      Write the results as JSON to <file>
+//   --native[=<path>]    Also run the native benchmark (default build/Release/native_bench, built by
+//                        `npm run bench:native`) and report the binding overhead of each sync operation
+
+const childProcess = require("child_process");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+
+const {
+  KEMs,
+  KeyEncapsulation,
+  Platform,
+  Sigs,
+  Signature
+} = require("../lib/index.js");
+const {measureSync, measureAsync, memory} = require("./harness.js");
+
+function parseArgs(argv) {
+  const args = {
+    filter: "",
+    time: 500,
+    iterations: 5,
+    sizes: [32, 1024, 65536],
+    concurrency: os.cpus().length,
+    async: true,
+    json: false,
+    output: null,
+    native: null
+  };
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, "").split("=");
+    switch (key) {
+      case "filter": args.filter = value; break;
+      case "time": args.time = Number(value); break;
+      case "iterations": args.iterations = Number(value); break;
+      case "sizes": args.sizes = value.split(",").map(Number); break;
+      case "concurrency": args.concurrency = Number(value); break;
+      case "no-async": args.async = false; break;
+      case "json": args.json = true; break;
+      case "output": args.output = value; break;
+      case "native": args.native = value || path.join(__dirname, "../build/Release/native_bench"); break;
+      default: throw new Error(`Unknown option: ${arg}`);
+    }
+  }
+  return args;
+}
+
+const log = (...parts) => process.stderr.write(parts.join(" ") + "\n");
+
+const format = (name, result) => {
+  const {opsPerSec, latencyUs} = result;
+  return `  ${name.padEnd(28)} ${opsPerSec.toFixed(1).padStart(12)} ops/s` +
+    `  p50 ${latencyUs.p50.toFixed(1).padStart(10)} us  p99 ${latencyUs.p99.toFixed(1).padStart(10)} us`;
+};
+
+let peak = memory();
+
+/**
+ * Records the highest memory usage seen since the last reset, sampled after each operation.
+ */
+function trackPeak() {
+  const current = memory();
+  for (const key of Object.keys(peak)) {
+    peak[key] = Math.max(peak[key], current[key]);
+  }
+}
+
+/**
+ * Runs one operation, logs it and records it under `name`.
+ */
+async function run(results, name, measure) {
+  const result = await measure();
+  results[name] = result;
+  trackPeak();
+  log(format(name, result));
+}
+
+async function benchKEM(algorithm, args) {
+  const options = {minTimeMs: args.time, minIterations: args.iterations, warmup: 1};
+  const asyncOptions = {...options, concurrency: args.concurrency};
+  const keygen = new KeyEncapsulation(algorithm);
+  const receiver = new KeyEncapsulation(algorithm);
+  const publicKey = receiver.generateKeypair();
+  const {ciphertext} = receiver.encapsulateSecret(publicKey);
+  const operations = {};
+  await run(operations, "generateKeypair", () => measureSync(() => keygen.generateKeypair(), options));
+  await run(operations, "encapsulateSecret", () => measureSync(() => receiver.encapsulateSecret(publicKey), options));
+  await run(operations, "decapsulateSecret", () => measureSync(() => receiver.decapsulateSecret(ciphertext), options));
+  if (args.async && typeof keygen.generateKeypairAsync === "function") {
+    await run(operations, "generateKeypairAsync", () => measureAsync(() => keygen.generateKeypairAsync(), asyncOptions));
+    await run(operations, "encapsulateSecretAsync", () => measureAsync(() => receiver.encapsulateSecretAsync(publicKey), asyncOptions));
+    await run(operations, "decapsulateSecretAsync", () => measureAsync(() => receiver.decapsulateSecretAsync(ciphertext), asyncOptions));
+  }
+  return {details: receiver.getDetails(), operations};
+}
+
+async function benchSig(algorithm, args) {
+  const options = {minTimeMs: args.time, minIterations: args.iterations, warmup: 1};
+  const asyncOptions = {...options, concurrency: args.concurrency};
+  const keygen = new Signature(algorithm);
+  const operations = {};
+  await run(operations, "generateKeypair", () => measureSync(() => keygen.generateKeypair(), options));
+  const signer = new Signature(algorithm);
+  const publicKey = signer.generateKeypair();
+  for (const size of args.sizes) {
+    const message = Buffer.alloc(size, "TCosmo");
+    const signature = signer.sign(message);
+    await run(operations, `sign/${size}`, () => measureSync(() => signer.sign(message), options));
+    await run(operations, `verify/${size}`, () => measureSync(() => signer.verify(message, signature, publicKey), options));
+    if (args.async && typeof signer.signAsync === "function") {
+      await run(operations, `signAsync/${size}`, () => measureAsync(() => signer.signAsync(message), asyncOptions));
+      await run(operations, `verifyAsync/${size}`, () => measureAsync(() => signer.verifyAsync(message, signature, publicKey), asyncOptions));
+    }
+  }
+  if (args.async && typeof keygen.generateKeypairAsync === "function") {
+    await run(operations, "generateKeypairAsync", () => measureAsync(() => keygen.generateKeypairAsync(), asyncOptions));
+  }
+  return {details: signer.getDetails(), operations};
+}
+
+/**
+ * Benchmarks every matching algorithm with `bench`, recording the memory usage around each one.
+ */
+async function benchAll(kind, algorithms, bench, args) {
+  const results = {};
+  for (const algorithm of algorithms.filter((name) => name.includes(args.filter))) {
+    log(`${kind} ${algorithm} (${Platform.getImplementation(algorithm).implementation})`);
+    const memoryBefore = memory();
+    peak = memory();
+    const result = await bench(algorithm, args);
+    const memoryPeak = peak;
+    if (global.gc) {
+      global.gc();
+    }
+    const {implementation} = Platform.getImplementation(algorithm);
+    results[algorithm] = {...result, implementation, memoryBefore, memoryPeak, memoryAfter: memory()};
+  }
+  return results;
+}
+
+/**
+ * Runs the native benchmark with the same options, for the raw liboqs timings.
+ */
+function runNative(args) {
+  log(`Native benchmark (${args.native})`);
+  const output = childProcess.execFileSync(args.native, [
+    `--filter=${args.filter}`,
+    `--time=${args.time}`,
+    `--iterations=${args.iterations}`,
+    `--sizes=${args.sizes.join(",")}`
+  ], {stdio: ["ignore", "pipe", "inherit"], maxBuffer: 64 * 1024 * 1024});
+  return JSON.parse(output.toString());
+}
+
+/**
+ * Adds the native timings and the binding overhead (JS latency minus native latency) to each algorithm
+ * for every operation that both benchmarks measured.
+ */
+function addOverhead(kind, results, nativeResults) {
+  for (const [algorithm, result] of Object.entries(results)) {
+    const nativeResult = nativeResults[algorithm];
+    if (!nativeResult) {
+      continue;
+    }
+    result.native = nativeResult.operations;
+    result.bindingOverheadUs = {};
+    log(`${kind} ${algorithm} binding overhead`);
+    for (const [name, native] of Object.entries(nativeResult.operations)) {
+      const js = result.operations[name];
+      if (!js) {
+        continue;
+      }
+      const overhead = {
+        mean: js.latencyUs.mean - native.latencyUs.mean,
+        p50: js.latencyUs.p50 - native.latencyUs.p50
+      };
+      result.bindingOverheadUs[name] = overhead;
+      log(`  ${name.padEnd(28)} mean ${overhead.mean.toFixed(2).padStart(10)} us  p50 ${overhead.p50.toFixed(2).padStart(10)} us`);
+    }
+  }
+}
+
+async function main() {
+  const args = parseArgs(process.argv.slice(2));
+  const build = Platform.getBuildInfo();
+  log(`liboqs ${build.liboqsVersion}, ${build.hostTuned ? "host-tuned" : "distributable"} build`);
+  const report = {
+    meta: {
+      version: require("../package.json").version,
+      node: process.version,
+      platform: process.platform,
+      arch: process.arch,
+      cpus: os.cpus().length,
+      cpuModel: os.cpus()[0].model,
+      date: new Date().toISOString(),
+      build,
+      cpuFeatures: Platform.getCpuFeatures(),
+      options: args
+    },
+    kems: await benchAll("KEM", KEMs.getEnabledAlgorithms(), benchKEM, args),
+    sigs: await benchAll("Signature", Sigs.getEnabledAlgorithms(), benchSig, args),
+    memory: memory()
+  };
+  if (args.native) {
+    const nativeReport = runNative(args);
+    addOverhead("KEM", report.kems, nativeReport.kems);
+    addOverhead("Signature", report.sigs, nativeReport.sigs);
+  }
+  const json = JSON.stringify(report, null, 2);
+  if (args.output) {
+    fs.writeFileSync(args.output, json + "\n");
+  }
+  if (args.json) {
+    process.stdout.write(json + "\n");
+  }
+}
+
+main().catch((err) => {
+  log(err.stack);
+  process.exitCode = 1;
+});
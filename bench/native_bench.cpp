@@ -0,0 +1,198 @@
+// Times the raw liboqs operations, without any of the N-API glue in src/.
+// Prints the results as JSON in the same shape as the JS benchmark, which subtracts them to get the binding overhead.
+//
+// Usage: native_bench [--filter=<text>] [--time=<ms>] [--iterations=<n>] [--sizes=<n,...>]
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <oqs/oqs.h>
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  struct Args {
+    std::string filter;
+    long time = 500;
+    long iterations = 5;
+    std::vector<std::size_t> sizes = {32, 1024, 65536};
+  };
+
+  struct Result {
+    std::size_t iterations;
+    double opsPerSec;
+    double mean;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+  };
+
+  Args parseArgs(int argc, char** argv) {
+    Args args;
+    for (int i = 1; i < argc; i++) {
+      const std::string arg = argv[i];
+      const auto eq = arg.find('=');
+      const std::string key = arg.substr(0, eq);
+      const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+      if (key == "--filter") {
+        args.filter = value;
+      } else if (key == "--time") {
+        args.time = std::strtol(value.c_str(), nullptr, 10);
+      } else if (key == "--iterations") {
+        args.iterations = std::strtol(value.c_str(), nullptr, 10);
+      } else if (key == "--sizes") {
+        args.sizes.clear();
+        std::stringstream sizes(value);
+        std::string size;
+        while (std::getline(sizes, size, ',')) {
+          args.sizes.push_back(std::strtoul(size.c_str(), nullptr, 10));
+        }
+      } else {
+        std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+        std::exit(1);
+      }
+    }
+    return args;
+  }
+
+  /**
+   * Calls `fn` until at least `args.time` milliseconds have passed and `args.iterations` calls have been made,
+   * after one warmup call. Latencies are in microseconds.
+   */
+  Result measure(const Args& args, const std::function<void()>& fn) {
+    fn();
+    std::vector<double> latencies;
+    const auto minTime = std::chrono::milliseconds(args.time);
+    Clock::duration elapsed(0);
+    while (elapsed < minTime || latencies.size() < static_cast<std::size_t>(args.iterations)) {
+      const auto start = Clock::now();
+      fn();
+      const auto latency = Clock::now() - start;
+      elapsed += latency;
+      latencies.push_back(std::chrono::duration<double, std::micro>(latency).count());
+    }
+    double total = 0;
+    for (double latency : latencies) {
+      total += latency;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) -> double {
+      return latencies[std::min(latencies.size() - 1, static_cast<std::size_t>(latencies.size() * p))];
+    };
+    return {
+      latencies.size(),
+      latencies.size() / std::chrono::duration<double>(elapsed).count(),
+      total / latencies.size(),
+      percentile(0.5),
+      percentile(0.9),
+      percentile(0.99),
+      latencies.back()
+    };
+  }
+
+  void printResult(const std::string& name, const Result& result, bool last) {
+    std::printf(
+      "        \"%s\": {\"iterations\": %zu, \"opsPerSec\": %f, \"latencyUs\": "
+      "{\"mean\": %f, \"p50\": %f, \"p90\": %f, \"p99\": %f, \"max\": %f}}%s\n",
+      name.c_str(), result.iterations, result.opsPerSec,
+      result.mean, result.p50, result.p90, result.p99, result.max,
+      last ? "" : ","
+    );
+  }
+
+  bool selected(const Args& args, const std::string& name) {
+    return name != "DEFAULT" && name.find(args.filter) != std::string::npos;
+  }
+
+  void benchKEMs(const Args& args) {
+    std::printf("  \"kems\": {\n");
+    bool first = true;
+    for (int i = 0; i < OQS_KEM_alg_count(); i++) {
+      const std::string name = OQS_KEM_alg_identifier(i);
+      if (!OQS_KEM_alg_is_enabled(name.c_str()) || !selected(args, name)) {
+        continue;
+      }
+      OQS_KEM* kem = OQS_KEM_new(name.c_str());
+      if (kem == nullptr) {
+        continue;
+      }
+      std::fprintf(stderr, "KEM %s\n", name.c_str());
+      std::vector<std::uint8_t> publicKey(kem->length_public_key);
+      std::vector<std::uint8_t> secretKey(kem->length_secret_key);
+      std::vector<std::uint8_t> ciphertext(kem->length_ciphertext);
+      std::vector<std::uint8_t> sharedSecret(kem->length_shared_secret);
+      std::printf("%s    \"%s\": {\n      \"operations\": {\n", first ? "" : ",\n", name.c_str());
+      first = false;
+      printResult("generateKeypair", measure(args, [&]() {
+        OQS_KEM_keypair(kem, publicKey.data(), secretKey.data());
+      }), false);
+      printResult("encapsulateSecret", measure(args, [&]() {
+        OQS_KEM_encaps(kem, ciphertext.data(), sharedSecret.data(), publicKey.data());
+      }), false);
+      printResult("decapsulateSecret", measure(args, [&]() {
+        OQS_KEM_decaps(kem, sharedSecret.data(), ciphertext.data(), secretKey.data());
+      }), true);
+      std::printf("      }\n    }");
+      OQS_KEM_free(kem);
+    }
+    std::printf("\n  },\n");
+  }
+
+  void benchSigs(const Args& args) {
+    std::printf("  \"sigs\": {\n");
+    bool first = true;
+    for (int i = 0; i < OQS_SIG_alg_count(); i++) {
+      const std::string name = OQS_SIG_alg_identifier(i);
+      if (!OQS_SIG_alg_is_enabled(name.c_str()) || !selected(args, name)) {
+        continue;
+      }
+      OQS_SIG* sig = OQS_SIG_new(name.c_str());
+      if (sig == nullptr) {
+        continue;
+      }
+      std::fprintf(stderr, "Signature %s\n", name.c_str());
+      std::vector<std::uint8_t> publicKey(sig->length_public_key);
+      std::vector<std::uint8_t> secretKey(sig->length_secret_key);
+      std::vector<std::uint8_t> signature(sig->length_signature);
+      std::size_t signatureLength = 0;
+      std::printf("%s    \"%s\": {\n      \"operations\": {\n", first ? "" : ",\n", name.c_str());
+      first = false;
+      printResult("generateKeypair", measure(args, [&]() {
+        OQS_SIG_keypair(sig, publicKey.data(), secretKey.data());
+      }), args.sizes.empty());
+      for (std::size_t j = 0; j < args.sizes.size(); j++) {
+        const std::size_t size = args.sizes[j];
+        std::vector<std::uint8_t> message(size, 'T');
+        printResult("sign/" + std::to_string(size), measure(args, [&]() {
+          OQS_SIG_sign(sig, signature.data(), &signatureLength, message.data(), message.size(), secretKey.data());
+        }), false);
+        printResult("verify/" + std::to_string(size), measure(args, [&]() {
+          OQS_SIG_verify(sig, message.data(), message.size(), signature.data(), signatureLength, publicKey.data());
+        }), j + 1 == args.sizes.size());
+      }
+      std::printf("      }\n    }");
+      OQS_SIG_free(sig);
+    }
+    std::printf("\n  }\n");
+  }
+
+}
+
+int main(int argc, char** argv) {
+  const Args args = parseArgs(argc, argv);
+  std::printf("{\n");
+  benchKEMs(args);
+  benchSigs(args);
+  std::printf("}\n");
+  return 0;
+}
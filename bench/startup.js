@@ -0,0 +1,69 @@
+// Reports the size of the addon binary and how long loading it takes, to compare full and algorithm-subset builds.
+//
+// Usage: npm run bench:startup -- [options]
+//   --runs=<n>           Number of fresh processes to time (default 20)
+//   --json               Print the results as JSON to stdout
+
+const childProcess = require("child_process");
+const fs = require("fs");
+const path = require("path");
+
+function parseArgs(argv) {
+  const args = {runs: 20, json: false};
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, "").split("=");
+    switch (key) {
+      case "runs": args.runs = Number(value); break;
+      case "json": args.json = true; break;
+      default: throw new Error(`Unknown option: ${arg}`);
+    }
+  }
+  return args;
+}
+
+const log = (...parts) => process.stderr.write(parts.join(" ") + "\n");
+
+/**
+ * Times `script` in fresh Node.js processes, returning the wall-clock time of each run in milliseconds.
+ */
+function timeProcesses(script, runs) {
+  const times = [];
+  for (let i = 0; i < runs; i++) {
+    const start = process.hrtime.bigint();
+    childProcess.execFileSync(process.execPath, ["-e", script], {cwd: path.join(__dirname, ".."), stdio: "ignore"});
+    times.push(Number(process.hrtime.bigint() - start) / 1e6);
+  }
+  return times.sort((a, b) => a - b);
+}
+
+const median = (sorted) => sorted[Math.floor(sorted.length / 2)];
+
+function main() {
+  const args = parseArgs(process.argv.slice(2));
+  const {KEMs, Sigs, Platform} = require("../lib/index.js");
+  // Wherever bindings found the addon, it is in the module cache
+  const addonPath = Object.keys(require.cache).find((file) => file.endsWith(".node"));
+  // The time to load the addon is the time of a process that loads it minus that of an empty process
+  const baseline = timeProcesses("", args.runs);
+  const loaded = timeProcesses("require('./lib/index.js')", args.runs);
+  const report = {
+    build: Platform.getBuildInfo(),
+    enabledKEMs: KEMs.getEnabledAlgorithms().length,
+    enabledSigs: Sigs.getEnabledAlgorithms().length,
+    binarySizeBytes: fs.statSync(addonPath).size,
+    loadTimeMs: {
+      median: median(loaded) - median(baseline),
+      processMedian: median(loaded),
+      baselineMedian: median(baseline)
+    }
+  };
+  log(`Addon binary: ${(report.binarySizeBytes / 1024 / 1024).toFixed(2)} MiB (${addonPath})`);
+  log(`Enabled: ${report.enabledKEMs} KEMs, ${report.enabledSigs} signature algorithms`);
+  log(`Load time: ${report.loadTimeMs.median.toFixed(2)} ms (median of ${args.runs} processes, ` +
+    `${report.loadTimeMs.processMedian.toFixed(2)} ms with the addon, ${report.loadTimeMs.baselineMedian.toFixed(2)} ms without)`);
+  if (args.json) {
+    process.stdout.write(JSON.stringify(report, null, 2) + "\n");
+  }
+}
+
+main();
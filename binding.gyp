@@ -1,4 +1,8 @@
 {
+  "variables": {
+    "build_native_bench%": 0,
+    "host_tuned%": "<!(node -p \"process.env.LIBOQS_NODE_HOST_TUNED === '1' ? 1 : 0\")"
+  },
   "targets": [
     {
       "target_name": "liboqs_node",
@@ -21,11 +25,29 @@
       ],
       "sources": [
         "./src/addon.cpp",
+        "./src/AddonData.cpp",
+        "./src/Algorithms.cpp",
+        "./src/Buffers.cpp",
+        "./src/Drbg.cpp",
+        "./src/FileReader.cpp",
+        "./src/HybridKEM.cpp",
         "./src/KEMs.cpp",
         "./src/KeyEncapsulation.cpp",
+        "./src/KeypairBatch.cpp",
+        "./src/KeypairPool.cpp",
+        "./src/Parallel.cpp",
+        "./src/Platform.cpp",
+        "./src/Prehash.cpp",
+        "./src/PrehashSigner.cpp",
+        "./src/PrehashVerifier.cpp",
         "./src/Random.cpp",
+        "./src/SecureArena.cpp",
         "./src/Signature.cpp",
-        "./src/Sigs.cpp"
+        "./src/Sigs.cpp",
+        "./src/Slab.cpp",
+        "./src/SlotAllocator.cpp",
+        "./src/Stats.cpp",
+        "./src/ThreadPool.cpp"
       ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")",
@@ -38,6 +60,58 @@
       "defines": [
         "NAPI_CPP_EXCEPTIONS",
         "NAPI_VERSION=6"
+      ],
+      "conditions": [
+        ["host_tuned==1", {
+          "cflags_cc": [
+            "-march=native"
+          ],
+          "defines": [
+            "LIBOQS_NODE_HOST_TUNED"
+          ],
+          "conditions": [
+            ["target_arch=='arm64'", {
+              "xcode_settings": {
+                "OTHER_CPLUSPLUSFLAGS": [
+                  "-mcpu=native"
+                ]
+              }
+            }, {
+              "xcode_settings": {
+                "OTHER_CPLUSPLUSFLAGS": [
+                  "-march=native"
+                ]
+              }
+            }]
+          ]
+        }]
+      ]
+    },
+    {
+      "target_name": "native_bench",
+      "type": "executable",
+      "conditions": [
+        ["build_native_bench==0", {
+          "type": "none"
+        }]
+      ],
+      "dependencies": [
+        "liboqs_node"
+      ],
+      "cflags_cc": [
+        "-fexceptions",
+        "-std=c++2a"
+      ],
+      "sources": [
+        "./bench/native_bench.cpp"
+      ],
+      "include_dirs": [
+        "./deps/liboqs/build/include",
+        "./deps/liboqs-cpp/include"
+      ],
+      "libraries": [
+        "../deps/liboqs/build/lib/liboqs.a",
+        "-lcrypto"
       ]
     }
   ]
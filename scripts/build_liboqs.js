@@ -0,0 +1,105 @@
+// Builds the static liboqs library that the addon links against.
+//
+// By default liboqs is built to run on any CPU of its architecture (OQS_DIST_BUILD), choosing optimized
+// implementations at runtime. Set LIBOQS_NODE_HOST_TUNED=1 to build it for the CPU of this machine instead;
+// the result may not run on other machines. binding.gyp reads the same variable to build the addon to match,
+// which `npm run build:host` does.
+//
+// Set LIBOQS_NODE_ALGORITHMS to a comma-separated list of algorithm names (for example "Kyber768,Dilithium3")
+// to build only those algorithms (OQS_MINIMAL_BUILD), which makes the addon smaller and faster to load.
+// When installing from npm, `npm install liboqs-node --build-from-source --liboqs-algorithms=Kyber768,Dilithium3`
+// does the same.
+//
+// With --if-needed, liboqs is only rebuilt if it has not been built yet or was built with different options.
+
+const childProcess = require("child_process");
+const fs = require("fs");
+const path = require("path");
+
+const liboqsDir = path.join(__dirname, "../deps/liboqs");
+const buildDir = path.join(liboqsDir, "build");
+// Records the options of the last build, for --if-needed
+const stampPath = path.join(buildDir, "liboqs_node_build.json");
+
+/**
+ * Maps every algorithm name to the liboqs option that enables it, for example "Kyber768" to "OQS_ENABLE_KEM_kyber_768",
+ * using the identifiers defined in the liboqs headers.
+ */
+function readAlgorithmOptions() {
+  const options = new Map();
+  for (const [kind, header] of [["KEM", "src/kem/kem.h"], ["SIG", "src/sig/sig.h"]]) {
+    const source = fs.readFileSync(path.join(liboqsDir, header), "utf8");
+    const pattern = new RegExp(`#define OQS_${kind}_alg_(\\w+) "([^"]+)"`, "g");
+    for (const [, id, name] of source.matchAll(pattern)) {
+      if (id !== "default") {
+        options.set(name, `OQS_ENABLE_${kind}_${id}`);
+      }
+    }
+  }
+  return options;
+}
+
+function readConfig() {
+  const algorithmList = process.env.LIBOQS_NODE_ALGORITHMS || process.env.npm_config_liboqs_algorithms || "";
+  const algorithms = algorithmList.split(",").map((name) => name.trim()).filter((name) => name.length > 0);
+  return {
+    hostTuned: process.env.LIBOQS_NODE_HOST_TUNED === "1",
+    algorithms: algorithms.length > 0 ? algorithms.sort() : null
+  };
+}
+
+function readStamp() {
+  if (!fs.existsSync(path.join(buildDir, "include/oqs/oqs.h"))) {
+    return null;
+  }
+  if (!fs.existsSync(stampPath)) {
+    // Built before the options were recorded, so with the defaults
+    return {hostTuned: false, algorithms: null};
+  }
+  return JSON.parse(fs.readFileSync(stampPath, "utf8"));
+}
+
+function build(config) {
+  const options = [
+    "-DBUILD_SHARED_LIBS=OFF",
+    "-DCMAKE_BUILD_TYPE=Release",
+    "-DOQS_BUILD_ONLY_LIB=ON",
+    "-DOQS_USE_OPENSSL=ON"
+  ];
+  if (config.hostTuned) {
+    // With OQS_DIST_BUILD off, liboqs compiles for the host CPU (-march=native) and only includes
+    // the optimized implementations that it supports
+    options.push("-DOQS_DIST_BUILD=OFF", "-DOQS_OPT_TARGET=auto");
+  } else {
+    options.push("-DOQS_DIST_BUILD=ON");
+  }
+  if (config.algorithms !== null) {
+    const algorithmOptions = readAlgorithmOptions();
+    const enables = config.algorithms.map((name) => {
+      if (!algorithmOptions.has(name)) {
+        throw new Error(`Unknown algorithm in LIBOQS_NODE_ALGORITHMS: ${name}`);
+      }
+      return algorithmOptions.get(name);
+    });
+    options.push(`-DOQS_MINIMAL_BUILD=${enables.join(";")}`);
+  }
+  const variant = config.hostTuned ? "host-tuned" : "distributable";
+  const subset = config.algorithms !== null ? `, only ${config.algorithms.join(", ")}` : "";
+  console.log(`Building liboqs (${variant}${subset})`);
+  if (fs.rmSync) {
+    fs.rmSync(buildDir, {recursive: true, force: true});
+  } else if (fs.existsSync(buildDir)) {
+    // Node.js before 14.14 has no fs.rmSync
+    fs.rmdirSync(buildDir, {recursive: true});
+  }
+  fs.mkdirSync(buildDir);
+  childProcess.execFileSync("cmake", [...options, "-GNinja", ".."], {cwd: buildDir, stdio: "inherit"});
+  childProcess.execFileSync("ninja", [], {cwd: buildDir, stdio: "inherit"});
+  fs.writeFileSync(stampPath, JSON.stringify(config) + "\n");
+}
+
+const config = readConfig();
+if (process.argv.includes("--if-needed") && JSON.stringify(readStamp()) === JSON.stringify(config)) {
+  process.exit(0);
+}
+build(config);
@@ -0,0 +1,16 @@
+#include "AddonData.h"
+
+#include <napi.h>
+
+namespace AddonData {
+
+  InstanceData& get(Napi::Env env) {
+    return *env.GetInstanceData<InstanceData>();
+  }
+
+  void Init(Napi::Env env) {
+    // Freed by node-addon-api when the environment is torn down
+    env.SetInstanceData<InstanceData>(new InstanceData());
+  }
+
+} // namespace AddonData
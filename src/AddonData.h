@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <napi.h>
+
+namespace AddonData {
+
+  /**
+   * State that belongs to one instance of the addon.
+   * Every Node.js environment (the main thread and each worker thread) that loads the addon gets its own.
+   */
+  struct InstanceData {
+    Napi::FunctionReference keyEncapsulationConstructor;
+    Napi::FunctionReference signatureConstructor;
+    Napi::FunctionReference prehashSignerConstructor;
+    Napi::FunctionReference prehashVerifierConstructor;
+    // Frozen details objects of every enabled algorithm, keyed by name, see Algorithms
+    Napi::ObjectReference kemDetails;
+    Napi::ObjectReference sigDetails;
+    // Frozen arrays of the names of every enabled algorithm, see Algorithms
+    Napi::ObjectReference kemNames;
+    Napi::ObjectReference sigNames;
+    // External memory held by Buffers that has not been reported to V8 yet, see Buffers
+    std::int64_t unreportedExternalMemory = 0;
+  };
+
+  /**
+   * Gets the instance data of the environment.
+   */
+  InstanceData& get(Napi::Env env);
+
+  void Init(Napi::Env env);
+
+}
@@ -0,0 +1,193 @@
+#include "Algorithms.h"
+
+#include <exception>
+#include <string>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "AddonData.h"
+
+namespace Algorithms {
+
+  /**
+   * Intentionally never freed, since instances may look algorithms up during exit.
+   */
+  const Table<KEMDescriptor>& kems() {
+    static const auto* instance = []() -> Table<KEMDescriptor>* {
+      auto* table = new Table<KEMDescriptor>();
+      const std::size_t count = OQS_KEM_alg_count();
+      table->enabled.reserve(count);
+      for (std::size_t i = 0; i < count; i++) {
+        const std::string name = OQS_KEM_alg_identifier(i);
+        if (name == "DEFAULT" || !OQS_KEM_alg_is_enabled(name.c_str())) {
+          continue;
+        }
+        OQS_KEM* kem = OQS_KEM_new(name.c_str());
+        if (kem == nullptr) {
+          continue;
+        }
+        table->enabled.push_back({
+          kem->method_name,
+          kem->alg_version,
+          kem->claimed_nist_level,
+          kem->ind_cca,
+          kem->length_public_key,
+          kem->length_secret_key,
+          kem->length_ciphertext,
+          kem->length_shared_secret
+        });
+        OQS_KEM_free(kem);
+      }
+      for (std::size_t i = 0; i < count; i++) {
+        table->byName.emplace(OQS_KEM_alg_identifier(i), nullptr);
+      }
+      for (const auto& descriptor : table->enabled) {
+        table->byName[descriptor.name] = &descriptor;
+      }
+      // DEFAULT is an alias of another algorithm, possibly under a different identifier than its method name
+      OQS_KEM* defaultKEM = OQS_KEM_alg_is_enabled("DEFAULT") ? OQS_KEM_new("DEFAULT") : nullptr;
+      if (defaultKEM != nullptr) {
+        table->byName["DEFAULT"] = table->byName[defaultKEM->method_name];
+        OQS_KEM_free(defaultKEM);
+      }
+      return table;
+    }();
+    return *instance;
+  }
+
+  /**
+   * Intentionally never freed, since instances may look algorithms up during exit.
+   */
+  const Table<SigDescriptor>& sigs() {
+    static const auto* instance = []() -> Table<SigDescriptor>* {
+      auto* table = new Table<SigDescriptor>();
+      const std::size_t count = OQS_SIG_alg_count();
+      table->enabled.reserve(count);
+      for (std::size_t i = 0; i < count; i++) {
+        const std::string name = OQS_SIG_alg_identifier(i);
+        if (name == "DEFAULT" || !OQS_SIG_alg_is_enabled(name.c_str())) {
+          continue;
+        }
+        OQS_SIG* sig = OQS_SIG_new(name.c_str());
+        if (sig == nullptr) {
+          continue;
+        }
+        table->enabled.push_back({
+          sig->method_name,
+          sig->alg_version,
+          sig->claimed_nist_level,
+          sig->euf_cma,
+          sig->length_public_key,
+          sig->length_secret_key,
+          sig->length_signature
+        });
+        OQS_SIG_free(sig);
+      }
+      for (std::size_t i = 0; i < count; i++) {
+        table->byName.emplace(OQS_SIG_alg_identifier(i), nullptr);
+      }
+      for (const auto& descriptor : table->enabled) {
+        table->byName[descriptor.name] = &descriptor;
+      }
+      OQS_SIG* defaultSig = OQS_SIG_alg_is_enabled("DEFAULT") ? OQS_SIG_new("DEFAULT") : nullptr;
+      if (defaultSig != nullptr) {
+        table->byName["DEFAULT"] = table->byName[defaultSig->method_name];
+        OQS_SIG_free(defaultSig);
+      }
+      return table;
+    }();
+    return *instance;
+  }
+
+  template <typename Descriptor>
+  static const Descriptor& find(const Table<Descriptor>& table, const std::string& name) {
+    const auto entry = table.byName.find(name);
+    if (entry == table.byName.end()) {
+      throw oqs::MechanismNotSupportedError(name);
+    }
+    if (entry->second == nullptr) {
+      throw oqs::MechanismNotEnabledError(name);
+    }
+    return *entry->second;
+  }
+
+  const KEMDescriptor& findKEM(const std::string& name) {
+    return find(kems(), name);
+  }
+
+  const SigDescriptor& findSig(const std::string& name) {
+    return find(sigs(), name);
+  }
+
+  Napi::Object kemDetails(Napi::Env env, const std::string& name) {
+    try {
+      const KEMDescriptor& descriptor = findKEM(name);
+      return AddonData::get(env).kemDetails.Value().Get(descriptor.name).As<Napi::Object>();
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+  }
+
+  Napi::Object sigDetails(Napi::Env env, const std::string& name) {
+    try {
+      const SigDescriptor& descriptor = findSig(name);
+      return AddonData::get(env).sigDetails.Value().Get(descriptor.name).As<Napi::Object>();
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+  }
+
+  Napi::Array kemNames(Napi::Env env) {
+    return AddonData::get(env).kemNames.Value().As<Napi::Array>();
+  }
+
+  Napi::Array sigNames(Napi::Env env) {
+    return AddonData::get(env).sigNames.Value().As<Napi::Array>();
+  }
+
+  void Init(Napi::Env env) {
+    auto objectConstructor = env.Global().Get("Object").As<Napi::Object>();
+    auto freeze = objectConstructor.Get("freeze").As<Napi::Function>();
+    auto kemDetailsObj = Napi::Object::New(env);
+    auto kemNamesArray = Napi::Array::New(env);
+    for (const auto& descriptor : kems().enabled) {
+      kemNamesArray[kemNamesArray.Length()] = Napi::String::New(env, descriptor.name);
+      auto detailsObj = Napi::Object::New(env);
+      detailsObj["name"] = Napi::String::New(env, descriptor.name);
+      detailsObj["version"] = Napi::String::New(env, descriptor.version);
+      detailsObj["claimedNistLevel"] = Napi::Number::New(env, descriptor.claimedNistLevel);
+      detailsObj["isINDCCA"] = Napi::Boolean::New(env, descriptor.isINDCCA);
+      detailsObj["publicKeyLength"] = Napi::Number::New(env, descriptor.publicKeyLength);
+      detailsObj["secretKeyLength"] = Napi::Number::New(env, descriptor.secretKeyLength);
+      detailsObj["ciphertextLength"] = Napi::Number::New(env, descriptor.ciphertextLength);
+      detailsObj["sharedSecretLength"] = Napi::Number::New(env, descriptor.sharedSecretLength);
+      freeze.Call(objectConstructor, {detailsObj});
+      kemDetailsObj.Set(Napi::String::New(env, descriptor.name), detailsObj);
+    }
+    freeze.Call(objectConstructor, {kemNamesArray});
+    auto sigDetailsObj = Napi::Object::New(env);
+    auto sigNamesArray = Napi::Array::New(env);
+    for (const auto& descriptor : sigs().enabled) {
+      sigNamesArray[sigNamesArray.Length()] = Napi::String::New(env, descriptor.name);
+      auto detailsObj = Napi::Object::New(env);
+      detailsObj["name"] = Napi::String::New(env, descriptor.name);
+      detailsObj["version"] = Napi::String::New(env, descriptor.version);
+      detailsObj["claimedNistLevel"] = Napi::Number::New(env, descriptor.claimedNistLevel);
+      detailsObj["isEUFCMA"] = Napi::Boolean::New(env, descriptor.isEUFCMA);
+      detailsObj["publicKeyLength"] = Napi::Number::New(env, descriptor.publicKeyLength);
+      detailsObj["secretKeyLength"] = Napi::Number::New(env, descriptor.secretKeyLength);
+      detailsObj["maxSignatureLength"] = Napi::Number::New(env, descriptor.maxSignatureLength);
+      freeze.Call(objectConstructor, {detailsObj});
+      sigDetailsObj.Set(Napi::String::New(env, descriptor.name), detailsObj);
+    }
+    freeze.Call(objectConstructor, {sigNamesArray});
+    AddonData::InstanceData& data = AddonData::get(env);
+    data.kemDetails = Napi::Persistent(kemDetailsObj);
+    data.sigDetails = Napi::Persistent(sigDetailsObj);
+    data.kemNames = Napi::Persistent(kemNamesArray);
+    data.sigNames = Napi::Persistent(sigNamesArray);
+  }
+
+} // namespace Algorithms
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <napi.h>
+
+/**
+ * Descriptors of every KEM and signature algorithm, built once per process from liboqs.
+ * Lookups by name take constant time and need no OQS object.
+ */
+namespace Algorithms {
+
+  struct KEMDescriptor {
+    std::string name;
+    std::string version;
+    std::size_t claimedNistLevel;
+    bool isINDCCA;
+    std::size_t publicKeyLength;
+    std::size_t secretKeyLength;
+    std::size_t ciphertextLength;
+    std::size_t sharedSecretLength;
+  };
+
+  struct SigDescriptor {
+    std::string name;
+    std::string version;
+    std::size_t claimedNistLevel;
+    bool isEUFCMA;
+    std::size_t publicKeyLength;
+    std::size_t secretKeyLength;
+    std::size_t maxSignatureLength;
+  };
+
+  template <typename Descriptor>
+  struct Table {
+    // Every enabled algorithm in liboqs order, without the DEFAULT alias
+    std::vector<Descriptor> enabled;
+    // Every supported name, including DEFAULT, mapped to its descriptor, or to nullptr if it is not enabled
+    std::unordered_map<std::string, const Descriptor*> byName;
+  };
+
+  /**
+   * The tables, shared by every environment and thread. Built on first use.
+   */
+  const Table<KEMDescriptor>& kems();
+  const Table<SigDescriptor>& sigs();
+
+  /**
+   * Looks up an algorithm, throwing oqs::MechanismNotSupportedError or oqs::MechanismNotEnabledError if it cannot be used.
+   */
+  const KEMDescriptor& findKEM(const std::string& name);
+  const SigDescriptor& findSig(const std::string& name);
+
+  /**
+   * Gets the environment's frozen details object for an algorithm. Throws a TypeError if it cannot be used.
+   */
+  Napi::Object kemDetails(Napi::Env env, const std::string& name);
+  Napi::Object sigDetails(Napi::Env env, const std::string& name);
+
+  /**
+   * Gets the environment's frozen array of the names of every enabled algorithm.
+   */
+  Napi::Array kemNames(Napi::Env env);
+  Napi::Array sigNames(Napi::Env env);
+
+  /**
+   * Builds the frozen details objects of every enabled algorithm for the environment.
+   */
+  void Init(Napi::Env env);
+
+}
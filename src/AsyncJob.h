@@ -0,0 +1,108 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <napi.h>
+
+#include "ThreadPool.h"
+
+namespace AsyncJob {
+
+  /**
+   * The part of a job that lives on the main thread: the Promise to settle,
+   * the objects kept alive for the job, and the conversion of the result into a JS value.
+   * Freed by the finalizer of the job's thread-safe function.
+   */
+  template <typename Result>
+  struct Settlement {
+    Napi::Promise::Deferred deferred;
+    std::vector<Napi::ObjectReference> pinned;
+    std::function<Napi::Value(Napi::Env, Result&)> done;
+  };
+
+  /**
+   * What the work produced on the worker thread, handed over to the main thread.
+   */
+  template <typename Result>
+  struct Outcome {
+    Result result;
+    bool failed;
+    std::string error;
+  };
+
+  template <typename Result>
+  void settle(Napi::Env env, Settlement<Result>& settlement, Outcome<Result>& outcome) {
+    try {
+      if (outcome.failed) {
+        settlement.deferred.Reject(Napi::Error::New(env, outcome.error).Value());
+      } else {
+        settlement.deferred.Resolve(settlement.done(env, outcome.result));
+      }
+    } catch (const Napi::Error& err) {
+      settlement.deferred.Reject(err.Value());
+    }
+  }
+
+  /**
+   * Runs `work` on the addon's thread pool and returns a Promise that is settled with the result.
+   * `done` converts the result into a JS value once back on the main thread.
+   * Every object in `pinnedObjects` is kept alive until the job has settled.
+   */
+  template <typename Result>
+  Napi::Promise run(
+    Napi::Env env,
+    const std::vector<Napi::Object>& pinnedObjects,
+    std::function<Result()> work,
+    std::function<Napi::Value(Napi::Env, Result&)> done
+  ) {
+    auto settlement = new Settlement<Result>{Napi::Promise::Deferred::New(env), {}, std::move(done)};
+    settlement->pinned.reserve(pinnedObjects.size());
+    for (const auto& obj : pinnedObjects) {
+      settlement->pinned.push_back(Napi::Persistent(obj));
+    }
+    auto promise = settlement->deferred.Promise();
+    // The thread-safe function only carries results back; the JS function it wraps is never called
+    auto tsfn = Napi::ThreadSafeFunction::New(
+      env,
+      Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+      "liboqs-node",
+      0,
+      1,
+      settlement,
+      [](Napi::Env, Settlement<Result>* finishedSettlement) {
+        delete finishedSettlement;
+      }
+    );
+    try {
+      ThreadPool::submit([tsfn, settlement, work = std::move(work)]() {
+        auto outcome = new Outcome<Result>{Result(), false, ""};
+        try {
+          outcome->result = work();
+        } catch (const std::exception& ex) {
+          outcome->failed = true;
+          outcome->error = ex.what();
+        }
+        const auto status = tsfn.BlockingCall(outcome, [settlement](Napi::Env cbEnv, Napi::Function, Outcome<Result>* finishedOutcome) {
+          // The environment is null if it is being torn down
+          if (cbEnv != nullptr) {
+            settle(cbEnv, *settlement, *finishedOutcome);
+          }
+          delete finishedOutcome;
+        });
+        if (status != napi_ok) {
+          delete outcome;
+        }
+        tsfn.Release();
+      });
+    } catch (const std::exception& ex) {
+      // The job was never queued, so nothing else would settle the Promise or release the thread-safe function
+      settlement->deferred.Reject(Napi::Error::New(env, ex.what()).Value());
+      tsfn.Release();
+    }
+    return promise;
+  }
+
+} // namespace AsyncJob
@@ -0,0 +1,146 @@
+#include "Buffers.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+#include "common.h"
+
+#include "AddonData.h"
+#include "SecureArena.h"
+#include "Slab.h"
+
+namespace Buffers {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  // The size of one slab region; smaller changes are accumulated before being reported
+  static constexpr std::int64_t EXTERNAL_MEMORY_INCREMENT = 256 * 1024;
+
+  /**
+   * Records a change in the external memory held by the environment's Buffers,
+   * reporting it to V8 once the unreported total reaches EXTERNAL_MEMORY_INCREMENT.
+   */
+  static void adjustExternalMemory(Napi::Env env, std::int64_t change) {
+    auto* data = env.GetInstanceData<AddonData::InstanceData>();
+    if (data == nullptr) {
+      // The environment is being torn down
+      Napi::MemoryManagement::AdjustExternalMemory(env, change);
+      return;
+    }
+    data->unreportedExternalMemory += change;
+    if (data->unreportedExternalMemory >= EXTERNAL_MEMORY_INCREMENT || data->unreportedExternalMemory <= -EXTERNAL_MEMORY_INCREMENT) {
+      Napi::MemoryManagement::AdjustExternalMemory(env, data->unreportedExternalMemory);
+      data->unreportedExternalMemory = 0;
+    }
+  }
+
+  Napi::Buffer<byte> fromBytes(Napi::Env env, std::unique_ptr<bytes> vec, bool secret) {
+    if (vec == nullptr) {
+      throw Napi::Error::New(env, "Failed to allocate memory");
+    }
+    bytes* vecPtr = vec.get();
+    auto buffer = secret
+      ? Napi::Buffer<byte>::New(
+          env,
+          vecPtr->data(),
+          vecPtr->size(),
+          [](Napi::Env cbEnv, byte* /* unused */, bytes* finalizeVec) -> void {
+            adjustExternalMemory(cbEnv, -static_cast<std::int64_t>(finalizeVec->size()));
+            oqs::mem_cleanse(*finalizeVec);
+            delete finalizeVec;
+          },
+          vecPtr
+        )
+      : Napi::Buffer<byte>::New(
+          env,
+          vecPtr->data(),
+          vecPtr->size(),
+          [](Napi::Env cbEnv, byte* /* unused */, bytes* finalizeVec) -> void {
+            adjustExternalMemory(cbEnv, -static_cast<std::int64_t>(finalizeVec->size()));
+            delete finalizeVec;
+          },
+          vecPtr
+        );
+    // The Buffer finalizer owns the vector from here on
+    vec.release();
+    adjustExternalMemory(env, vecPtr->size());
+    return buffer;
+  }
+
+  Napi::Buffer<byte> fromBytes(Napi::Env env, bytes&& vec, bool secret) {
+    // Moving only transfers the vector's storage, so its contents are never copied
+    std::unique_ptr<bytes> vecPtr(new (std::nothrow) bytes(std::move(vec)));
+    if (vecPtr == nullptr) {
+      if (secret) {
+        oqs::mem_cleanse(vec);
+      }
+      throw Napi::Error::New(env, "Failed to allocate memory");
+    }
+    return fromBytes(env, std::move(vecPtr), secret);
+  }
+
+  Napi::Buffer<byte> fromBlock(Napi::Env env, SecureArena::Block&& block) {
+    const std::size_t size = block.size();
+    auto buffer = Napi::Buffer<byte>::New(
+      env,
+      block.data(),
+      size,
+      [size](Napi::Env cbEnv, byte* data) -> void {
+        adjustExternalMemory(cbEnv, -static_cast<std::int64_t>(size));
+        SecureArena::release(data, size);
+      }
+    );
+    // The Buffer finalizer owns the memory from here on
+    block.relinquish();
+    adjustExternalMemory(env, size);
+    return buffer;
+  }
+
+  Napi::Buffer<byte> fromBlock(Napi::Env env, Slab::Block&& block, std::size_t length) {
+    const std::size_t size = block.size();
+    auto buffer = Napi::Buffer<byte>::New(
+      env,
+      block.data(),
+      std::min(length, size),
+      [size](Napi::Env cbEnv, byte* data) -> void {
+        adjustExternalMemory(cbEnv, -static_cast<std::int64_t>(size));
+        Slab::allocator().release(data, size);
+      }
+    );
+    // The Buffer finalizer owns the memory from here on
+    block.relinquish();
+    adjustExternalMemory(env, size);
+    return buffer;
+  }
+
+  Slab::Block allocatePublic(Napi::Env env, std::size_t size) {
+    try {
+      return Slab::Block(size);
+    } catch (const std::bad_alloc&) {
+      throw Napi::Error::New(env, "Failed to allocate memory");
+    }
+  }
+
+  SecureArena::Block allocateSecret(Napi::Env env, std::size_t size) {
+    try {
+      return SecureArena::Block(size);
+    } catch (const std::bad_alloc&) {
+      throw Napi::Error::New(env, "Failed to allocate memory");
+    }
+  }
+
+  Napi::Buffer<byte> copySecret(Napi::Env env, const byte* data, std::size_t size) {
+    SecureArena::Block block = allocateSecret(env, size);
+    std::copy(data, data + size, block.data());
+    return fromBlock(env, std::move(block));
+  }
+
+} // namespace Buffers
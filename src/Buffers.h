@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "SecureArena.h"
+#include "Slab.h"
+
+/**
+ * Helpers to hand native memory over to Buffers.
+ * External memory is reported to V8 in coarse increments of at least one slab region per environment
+ * rather than once per Buffer, since small, short-lived Buffers are created and collected at a high rate.
+ */
+namespace Buffers {
+
+  /**
+   * Wraps a heap-allocated byte vector in a Buffer that takes ownership of it.
+   * The vector is cleansed before being freed if `secret` is true.
+   */
+  Napi::Buffer<oqs::byte> fromBytes(Napi::Env env, std::unique_ptr<oqs::bytes> vec, bool secret);
+
+  /**
+   * Moves a byte vector into a Buffer without copying its contents.
+   * The vector is cleansed before being freed if `secret` is true.
+   */
+  Napi::Buffer<oqs::byte> fromBytes(Napi::Env env, oqs::bytes&& vec, bool secret);
+
+  /**
+   * Wraps secret memory from the SecureArena in a Buffer that takes ownership of it.
+   * The memory is cleansed and returned to the arena when the Buffer is garbage collected.
+   */
+  Napi::Buffer<oqs::byte> fromBlock(Napi::Env env, SecureArena::Block&& block);
+
+  /**
+   * Wraps the first `length` bytes of a slab slot holding a public output in a Buffer that takes ownership of it.
+   * `length` may be less than the size of the block, for example for variable-length signatures.
+   * The slot is returned to the slabs when the Buffer is garbage collected.
+   */
+  Napi::Buffer<oqs::byte> fromBlock(Napi::Env env, Slab::Block&& block, std::size_t length);
+
+  /**
+   * Allocates memory for a public output from the slabs, throwing a JS error if none is available.
+   */
+  Slab::Block allocatePublic(Napi::Env env, std::size_t size);
+
+  /**
+   * Allocates memory for a secret from the SecureArena, throwing a JS error if none is available.
+   */
+  SecureArena::Block allocateSecret(Napi::Env env, std::size_t size);
+
+  /**
+   * Copies a secret into a new Buffer backed by the SecureArena.
+   */
+  Napi::Buffer<oqs::byte> copySecret(Napi::Env env, const oqs::byte* data, std::size_t size);
+
+}
@@ -0,0 +1,128 @@
+#include "Drbg.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include <oqs/sha3.h>
+#include <openssl/rand.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "SecureArena.h"
+
+namespace Drbg {
+
+  using oqs::byte;
+
+  static constexpr std::size_t KEY_SIZE = 32;
+  static constexpr std::size_t CHUNK_SIZE = 16384;
+  static constexpr std::uint64_t RESEED_INTERVAL = 1 << 20;
+
+  // Incremented in the child after every fork(), so that its threads reseed instead of repeating the parent's output
+  static std::atomic<std::uint64_t> forkGeneration(0);
+
+  struct State {
+    // The key followed by the current chunk, kept in the SecureArena
+    SecureArena::Block block;
+    // The number of unread bytes at the end of the chunk
+    std::size_t available = 0;
+    std::uint64_t counter = 0;
+    std::uint64_t sinceReseed = 0;
+    std::uint64_t generation = 0;
+  };
+
+  // The block is cleansed when the thread exits
+  static thread_local State state;
+
+  /**
+   * Mixes fresh entropy from OpenSSL into the key and drops the rest of the chunk.
+   */
+  static void reseed(State& s) {
+    if (s.block.data() == nullptr) {
+      try {
+        s.block = SecureArena::Block(KEY_SIZE + CHUNK_SIZE);
+      } catch (const std::bad_alloc&) {
+        std::abort();
+      }
+      std::memset(s.block.data(), 0, KEY_SIZE + CHUNK_SIZE);
+    }
+    byte input[2 * KEY_SIZE];
+    std::memcpy(input, s.block.data(), KEY_SIZE);
+    if (RAND_bytes(input + KEY_SIZE, KEY_SIZE) != 1) {
+      // Returning without output would make callers use predictable bytes
+      std::abort();
+    }
+    OQS_SHA3_shake256(s.block.data(), KEY_SIZE, input, sizeof(input));
+    OQS_MEM_cleanse(input, sizeof(input));
+    OQS_MEM_cleanse(s.block.data() + KEY_SIZE, CHUNK_SIZE);
+    s.available = 0;
+    s.sinceReseed = 0;
+    s.generation = forkGeneration.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Squeezes the next key and chunk from the current key and counter.
+   */
+  static void refill(State& s) {
+    byte input[KEY_SIZE + 8];
+    std::memcpy(input, s.block.data(), KEY_SIZE);
+    for (std::size_t i = 0; i < 8; i++) {
+      input[KEY_SIZE + i] = static_cast<byte>(s.counter >> (8 * i));
+    }
+    OQS_SHA3_shake256(s.block.data(), KEY_SIZE + CHUNK_SIZE, input, sizeof(input));
+    OQS_MEM_cleanse(input, sizeof(input));
+    s.counter++;
+    s.available = CHUNK_SIZE;
+  }
+
+  void randombytes(std::uint8_t* random_array, std::size_t bytes_to_read) {
+    State& s = state;
+    if (s.block.data() == nullptr ||
+        s.generation != forkGeneration.load(std::memory_order_acquire) ||
+        s.sinceReseed >= RESEED_INTERVAL) {
+      reseed(s);
+    }
+    while (bytes_to_read > 0) {
+      if (s.available == 0) {
+        refill(s);
+      }
+      const std::size_t take = std::min(bytes_to_read, s.available);
+      byte* chunk = s.block.data() + KEY_SIZE + CHUNK_SIZE - s.available;
+      std::memcpy(random_array, chunk, take);
+      // Bytes that have been handed out must not be recoverable from the state
+      OQS_MEM_cleanse(chunk, take);
+      s.available -= take;
+      s.sinceReseed += take;
+      random_array += take;
+      bytes_to_read -= take;
+    }
+  }
+
+#ifndef _WIN32
+  static void afterForkInChild() {
+    forkGeneration.fetch_add(1, std::memory_order_release);
+  }
+#endif
+
+  void install() {
+    static std::once_flag registered;
+    std::call_once(registered, []() -> void {
+#ifndef _WIN32
+      pthread_atfork(nullptr, nullptr, afterForkInChild);
+#endif
+    });
+    OQS_randombytes_custom_algorithm(randombytes);
+  }
+
+} // namespace Drbg
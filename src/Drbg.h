@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A buffered, per-thread SHAKE256-based DRBG that can be installed as liboqs's RNG.
+ * Each thread keeps a 256-bit key and squeezes `SHAKE256(key || counter)` in 16 KiB chunks,
+ * the first 32 bytes of which replace the key, so earlier output cannot be recomputed from a later state.
+ * Output is handed out from the chunk, so most requests need no system call.
+ * Keys are seeded from OpenSSL's RNG and reseeded after every MiB of output, and after fork() in the child.
+ */
+namespace Drbg {
+
+  /**
+   * The name that selects the DRBG in Random.switchAlgorithm.
+   */
+  constexpr char ALGORITHM[] = "SHAKE256-DRBG";
+
+  /**
+   * Fills `random_array` with `bytes_to_read` random bytes from the calling thread's DRBG.
+   * Matches the signature of liboqs's custom RNG hook. Aborts if the DRBG cannot be seeded.
+   */
+  void randombytes(std::uint8_t* random_array, std::size_t bytes_to_read);
+
+  /**
+   * Makes liboqs draw random bytes from the DRBG.
+   */
+  void install();
+
+}
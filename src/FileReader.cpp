@@ -0,0 +1,78 @@
+#include "FileReader.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FILE_READER_POSIX 1
+#endif
+
+using oqs::byte;
+
+#ifdef FILE_READER_POSIX
+
+FileReader::FileReader(const std::string& path) : path_(path), fd_(-1) {
+  fd_ = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd_ < 0) {
+    throw std::runtime_error("Can not open " + path + ": " + std::strerror(errno));
+  }
+  struct stat st;
+  if (fstat(fd_, &st) != 0) {
+    const int error = errno;
+    close(fd_);
+    throw std::runtime_error("Can not read " + path + ": " + std::strerror(error));
+  }
+  if (!S_ISREG(st.st_mode)) {
+    close(fd_);
+    throw std::runtime_error("Can not read " + path + ": Not a regular file");
+  }
+#ifdef POSIX_FADV_SEQUENTIAL
+  posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
+FileReader::~FileReader() {
+  close(fd_);
+}
+
+std::size_t FileReader::read(byte* buffer, std::size_t length) {
+  for (;;) {
+    const ssize_t count = ::read(fd_, buffer, length);
+    if (count >= 0) {
+      return static_cast<std::size_t>(count);
+    }
+    if (errno != EINTR) {
+      throw std::runtime_error("Can not read " + path_ + ": " + std::strerror(errno));
+    }
+  }
+}
+
+#else
+
+FileReader::FileReader(const std::string& path) : path_(path), file_(path, std::ios::binary) {
+  if (!file_) {
+    throw std::runtime_error("Can not open " + path);
+  }
+}
+
+FileReader::~FileReader() = default;
+
+std::size_t FileReader::read(byte* buffer, std::size_t length) {
+  file_.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(length));
+  if (file_.bad()) {
+    throw std::runtime_error("Can not read " + path_);
+  }
+  return static_cast<std::size_t>(file_.gcount());
+}
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+/**
+ * Reads a file front to back in caller-sized windows, so that large files can be processed with constant memory use.
+ * Unlike a memory mapping, a file that is truncated while it is read cannot crash the process;
+ * the read just ends early. Opening and reading block, so use it from worker threads.
+ */
+class FileReader {
+  private:
+    std::string path_;
+#if defined(__unix__) || defined(__APPLE__)
+    int fd_;
+#else
+    std::ifstream file_;
+#endif
+
+  public:
+    /**
+     * Opens the file, throwing std::runtime_error if it cannot be read.
+     */
+    explicit FileReader(const std::string& path);
+    FileReader(const FileReader&) = delete;
+    FileReader& operator=(const FileReader&) = delete;
+    ~FileReader();
+
+    /**
+     * Reads up to `length` bytes into `buffer`, returning how many were read, or 0 at the end of the file.
+     * Throws std::runtime_error if reading fails.
+     */
+    std::size_t read(oqs::byte* buffer, std::size_t length);
+};
@@ -0,0 +1,511 @@
+// exports.HybridKEM
+
+#include "HybridKEM.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include <oqs/sha3.h>
+#include <openssl/evp.h>
+
+#include "Algorithms.h"
+#include "AsyncJob.h"
+#include "Buffers.h"
+#include "Random.h"
+#include "Slab.h"
+
+namespace HybridKEM {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  static constexpr std::size_t X25519_KEY_LENGTH = 32;
+  static constexpr std::size_t SHARED_SECRET_LENGTH = 32;
+  // Domain separator appended to the input of the combiner
+  static constexpr char COMBINER_LABEL[] = "liboqs-node X25519 hybrid";
+
+  using PKey = std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)>;
+  using PKeyContext = std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)>;
+
+  /**
+   * Computes the X25519 public key of a secret key.
+   */
+  static void x25519PublicKey(const byte* secretKey, byte* publicKey) {
+    PKey key(EVP_PKEY_new_raw_private_key(EVP_PKEY_X25519, nullptr, secretKey, X25519_KEY_LENGTH), &EVP_PKEY_free);
+    std::size_t length = X25519_KEY_LENGTH;
+    if (
+      key == nullptr ||
+      EVP_PKEY_get_raw_public_key(key.get(), publicKey, &length) != 1 ||
+      length != X25519_KEY_LENGTH
+    ) {
+      throw std::runtime_error("Can not compute X25519 public key");
+    }
+  }
+
+  /**
+   * Generates an X25519 secret key followed by its public key, drawing from the liboqs RNG
+   * so that Random.switchAlgorithm applies to both halves of the hybrid.
+   */
+  static void x25519GenerateKey(byte* key) {
+    {
+      Random::Guard guard;
+      OQS_randombytes(key, X25519_KEY_LENGTH);
+    }
+    x25519PublicKey(key, key + X25519_KEY_LENGTH);
+  }
+
+  /**
+   * Computes the X25519 shared secret between a secret key and a peer's public key.
+   * OpenSSL rejects peer keys of small order, which would give an all-zero secret.
+   */
+  static void x25519Derive(const byte* secretKey, const byte* peerPublicKey, byte* sharedSecret) {
+    PKey key(EVP_PKEY_new_raw_private_key(EVP_PKEY_X25519, nullptr, secretKey, X25519_KEY_LENGTH), &EVP_PKEY_free);
+    PKey peer(EVP_PKEY_new_raw_public_key(EVP_PKEY_X25519, nullptr, peerPublicKey, X25519_KEY_LENGTH), &EVP_PKEY_free);
+    if (key == nullptr || peer == nullptr) {
+      throw std::runtime_error("Invalid X25519 key");
+    }
+    PKeyContext context(EVP_PKEY_CTX_new(key.get(), nullptr), &EVP_PKEY_CTX_free);
+    std::size_t length = X25519_KEY_LENGTH;
+    if (
+      context == nullptr ||
+      EVP_PKEY_derive_init(context.get()) != 1 ||
+      EVP_PKEY_derive_set_peer(context.get(), peer.get()) != 1 ||
+      EVP_PKEY_derive(context.get(), sharedSecret, &length) != 1 ||
+      length != X25519_KEY_LENGTH
+    ) {
+      OQS_MEM_cleanse(sharedSecret, X25519_KEY_LENGTH);
+      throw std::runtime_error("Can not compute X25519 shared secret");
+    }
+  }
+
+  /**
+   * Combines the two shared secrets into the final one:
+   * SHA3-256(ss_pq || ss_x25519 || ciphertext || pk_x25519 || label),
+   * where the ciphertext is the whole hybrid ciphertext, so that the result is bound to both ciphertexts
+   * even for KEMs that do not bind their own.
+   */
+  static void combine(
+    oqs_span::byte_span pqSharedSecret,
+    const byte* x25519SharedSecret,
+    oqs_span::byte_span ciphertext,
+    const byte* x25519PublicKey,
+    byte* sharedSecret
+  ) {
+    const std::size_t labelLength = sizeof(COMBINER_LABEL) - 1;
+    SecureArena::Block input(
+      pqSharedSecret.size + X25519_KEY_LENGTH + ciphertext.size + X25519_KEY_LENGTH + labelLength
+    );
+    byte* cursor = input.data();
+    cursor = std::copy(pqSharedSecret.data, pqSharedSecret.data + pqSharedSecret.size, cursor);
+    cursor = std::copy(x25519SharedSecret, x25519SharedSecret + X25519_KEY_LENGTH, cursor);
+    cursor = std::copy(ciphertext.data, ciphertext.data + ciphertext.size, cursor);
+    cursor = std::copy(x25519PublicKey, x25519PublicKey + X25519_KEY_LENGTH, cursor);
+    std::memcpy(cursor, COMBINER_LABEL, labelLength);
+    OQS_SHA3_sha3_256(sharedSecret, input.data(), input.size());
+  }
+
+  /**
+   * Constructs an instance of HybridKEM, which runs X25519 alongside a post-quantum KEM and combines
+   * both shared secrets natively, so a hybrid handshake takes one call per side.
+   * The shared secret is secure as long as either X25519 or the post-quantum KEM is.
+   * Public keys, secret keys and ciphertexts are the 32-byte X25519 value followed by the value of the post-quantum KEM.
+   * The 32-byte shared secret is SHA3-256 over both shared secrets, the ciphertext and the recipient's X25519 public key.
+   * @name HybridKEM
+   * @class
+   * @constructs HybridKEM
+   * @param {KEMs.Algorithm} algorithm - The post-quantum KEM algorithm to pair with X25519.
+   * @param {Buffer} [secretKey] - An optional hybrid secret key. If not specified, use HybridKEM#generateKeypair later to create a secret key.
+   *   The instance keeps its own copy of the secret key in memory that is locked into RAM where possible,
+   *   and cleanses it when the key is replaced or the instance is garbage collected.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  HybridKEM::HybridKEM(const Napi::CallbackInfo& info) : Napi::ObjectWrap<HybridKEM>(info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    const auto algorithm = info[0].As<Napi::String>().Utf8Value();
+    if (info.Length() >= 2) {
+      if (!info[1].IsBuffer()) {
+        throw Napi::TypeError::New(env, "Secret key must be a buffer");
+      }
+      const auto secretKeyBuffer = info[1].As<Napi::Buffer<byte>>();
+      if (secretKeyBuffer.Length() <= X25519_KEY_LENGTH) {
+        throw Napi::TypeError::New(env, "Incorrect secret key length");
+      }
+      try {
+        oqsKE = std::make_unique<oqs_span::KeyEncapsulation>(
+          algorithm,
+          oqs_span::byte_span{secretKeyBuffer.Data() + X25519_KEY_LENGTH, secretKeyBuffer.Length() - X25519_KEY_LENGTH}
+        );
+      } catch (const std::exception& ex) {
+        throw Napi::TypeError::New(env, ex.what());
+      }
+      if (secretKeyBuffer.Length() != X25519_KEY_LENGTH + oqsKE->get_details().length_secret_key) {
+        throw Napi::TypeError::New(env, "Incorrect secret key length");
+      }
+      try {
+        x25519Key = SecureArena::Block(2 * X25519_KEY_LENGTH);
+        std::copy(secretKeyBuffer.Data(), secretKeyBuffer.Data() + X25519_KEY_LENGTH, x25519Key.data());
+        x25519PublicKey(x25519Key.data(), x25519Key.data() + X25519_KEY_LENGTH);
+      } catch (const std::exception& ex) {
+        throw Napi::TypeError::New(env, ex.what());
+      }
+    } else {
+      try {
+        oqsKE = std::make_unique<oqs_span::KeyEncapsulation>(algorithm);
+      } catch (const std::exception& ex) {
+        throw Napi::TypeError::New(env, ex.what());
+      }
+    }
+  }
+
+  /**
+   * Generates both halves of a keypair into temporary blocks, and only replaces the instance's keys
+   * once both have succeeded, so a failure leaves the previous keypair intact.
+   */
+  void HybridKEM::generate(byte* publicKey) {
+    SecureArena::Block key(2 * X25519_KEY_LENGTH);
+    x25519GenerateKey(key.data());
+    SecureArena::Block pqSecretKey(oqsKE->get_details().length_secret_key);
+    oqsKE->generate_keypair(publicKey + X25519_KEY_LENGTH, pqSecretKey.data());
+    std::copy(key.data() + X25519_KEY_LENGTH, key.data() + 2 * X25519_KEY_LENGTH, publicKey);
+    std::lock_guard<std::mutex> lock(mutex);
+    oqsKE->set_secret_key(std::move(pqSecretKey));
+    x25519Key = std::move(key);
+  }
+
+  void HybridKEM::encapsulate(oqs_span::byte_span publicKey, byte* ciphertext, byte* sharedSecret) const {
+    const auto& details = oqsKE->get_details();
+    if (publicKey.size != X25519_KEY_LENGTH + details.length_public_key) {
+      throw std::runtime_error("Incorrect public key length");
+    }
+    // The ephemeral X25519 public key is the first part of the ciphertext
+    SecureArena::Block ephemeralKey(2 * X25519_KEY_LENGTH);
+    x25519GenerateKey(ephemeralKey.data());
+    std::copy(ephemeralKey.data() + X25519_KEY_LENGTH, ephemeralKey.data() + 2 * X25519_KEY_LENGTH, ciphertext);
+    SecureArena::Block secrets(X25519_KEY_LENGTH + details.length_shared_secret);
+    x25519Derive(ephemeralKey.data(), publicKey.data, secrets.data());
+    oqsKE->encap_secret(
+      {publicKey.data + X25519_KEY_LENGTH, details.length_public_key},
+      ciphertext + X25519_KEY_LENGTH,
+      secrets.data() + X25519_KEY_LENGTH
+    );
+    combine(
+      {secrets.data() + X25519_KEY_LENGTH, details.length_shared_secret},
+      secrets.data(),
+      {ciphertext, X25519_KEY_LENGTH + details.length_ciphertext},
+      publicKey.data,
+      sharedSecret
+    );
+  }
+
+  void HybridKEM::decapsulate(oqs_span::byte_span ciphertext, byte* sharedSecret) {
+    const auto& details = oqsKE->get_details();
+    if (ciphertext.size != X25519_KEY_LENGTH + details.length_ciphertext) {
+      throw std::runtime_error("Incorrect ciphertext length");
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (x25519Key.size() == 0) {
+      throw std::runtime_error(
+        "No secret key, make sure you specify one in the constructor or run generateKeypair()"
+      );
+    }
+    SecureArena::Block secrets(X25519_KEY_LENGTH + details.length_shared_secret);
+    x25519Derive(x25519Key.data(), ciphertext.data, secrets.data());
+    oqsKE->decap_secret(
+      {ciphertext.data + X25519_KEY_LENGTH, details.length_ciphertext},
+      secrets.data() + X25519_KEY_LENGTH
+    );
+    combine(
+      {secrets.data() + X25519_KEY_LENGTH, details.length_shared_secret},
+      secrets.data(),
+      ciphertext,
+      x25519Key.data() + X25519_KEY_LENGTH,
+      sharedSecret
+    );
+  }
+
+  /**
+   * Gets the details for the hybrid KEM that the instance was constructed with.
+   * The lengths are those of the hybrid values; `kem` holds the details of the post-quantum KEM.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @name getDetails
+   * @returns {Object} - An object containing the details of the hybrid KEM.
+   */
+  Napi::Value HybridKEM::getDetails(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    const auto& details = oqsKE->get_details();
+    auto detailsObj = Napi::Object::New(env);
+    detailsObj["name"] = Napi::String::New(env, "X25519+" + details.name);
+    detailsObj["kem"] = Algorithms::kemDetails(env, details.name);
+    detailsObj["publicKeyLength"] = Napi::Number::New(env, X25519_KEY_LENGTH + details.length_public_key);
+    detailsObj["secretKeyLength"] = Napi::Number::New(env, X25519_KEY_LENGTH + details.length_secret_key);
+    detailsObj["ciphertextLength"] = Napi::Number::New(env, X25519_KEY_LENGTH + details.length_ciphertext);
+    detailsObj["sharedSecretLength"] = Napi::Number::New(env, SHARED_SECRET_LENGTH);
+    return detailsObj;
+  }
+
+  /**
+   * Generates a hybrid keypair. Overwrites any existing secret key on the instance with the generated secret key.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @name generateKeypair
+   * @returns {Buffer} - A Buffer containing the hybrid public key.
+   * @throws {Error} Will throw an error if memory cannot be allocated.
+   */
+  Napi::Value HybridKEM::generateKeypair(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    try {
+      const std::size_t publicKeyLength = X25519_KEY_LENGTH + oqsKE->get_details().length_public_key;
+      Slab::Block publicKey = Buffers::allocatePublic(env, publicKeyLength);
+      generate(publicKey.data());
+      return Buffers::fromBlock(env, std::move(publicKey), publicKeyLength);
+    } catch (const std::exception& ex) {
+      throw Napi::Error::New(env, ex.what());
+    }
+  }
+
+  /**
+   * Exports the hybrid secret key.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @name exportSecretKey
+   * @returns {Buffer} - A Buffer containing the hybrid secret key, or an empty Buffer if there is none.
+   * @throws {Error} Will throw an error if memory cannot be allocated.
+   */
+  Napi::Value HybridKEM::exportSecretKey(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (x25519Key.size() == 0) {
+      return Buffers::copySecret(env, nullptr, 0);
+    }
+    const oqs_span::byte_span pqSecretKey = oqsKE->secret_key();
+    SecureArena::Block secretKey = Buffers::allocateSecret(env, X25519_KEY_LENGTH + pqSecretKey.size);
+    std::copy(x25519Key.data(), x25519Key.data() + X25519_KEY_LENGTH, secretKey.data());
+    std::copy(pqSecretKey.data, pqSecretKey.data + pqSecretKey.size, secretKey.data() + X25519_KEY_LENGTH);
+    return Buffers::fromBlock(env, std::move(secretKey));
+  }
+
+  /**
+   * Encapsulates a combined shared secret using a provided hybrid public key.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @name encapsulateSecret
+   * @param {Buffer} publicKey - The hybrid public key belonging to the intended recipient of the shared secret.
+   * @returns {KeyEncapsulation.CiphertextSharedSecretPair} - The hybrid ciphertext and combined shared secret.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if memory cannot be allocated.
+   */
+  Napi::Value HybridKEM::encapsulateSecret(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Public key must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Public key must be a buffer");
+    }
+    const auto publicKeyBuffer = info[0].As<Napi::Buffer<byte>>();
+    const std::size_t ciphertextLength = X25519_KEY_LENGTH + oqsKE->get_details().length_ciphertext;
+    SecureArena::Block sharedSecret = Buffers::allocateSecret(env, SHARED_SECRET_LENGTH);
+    try {
+      Slab::Block ciphertext = Buffers::allocatePublic(env, ciphertextLength);
+      encapsulate({publicKeyBuffer.Data(), publicKeyBuffer.Length()}, ciphertext.data(), sharedSecret.data());
+      auto ciphertextSharedSecretPair = Napi::Object::New(env);
+      ciphertextSharedSecretPair.Set(
+        Napi::String::New(env, "ciphertext"),
+        Buffers::fromBlock(env, std::move(ciphertext), ciphertextLength)
+      );
+      ciphertextSharedSecretPair.Set(
+        Napi::String::New(env, "sharedSecret"),
+        Buffers::fromBlock(env, std::move(sharedSecret))
+      );
+      return ciphertextSharedSecretPair;
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+  }
+
+  /**
+   * Decapsulates the combined shared secret from a hybrid ciphertext.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @name decapsulateSecret
+   * @param {Buffer} ciphertext - The hybrid ciphertext that was encrypted using the instance's public key.
+   * @returns {Buffer} - The combined shared secret.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if memory cannot be allocated.
+   */
+  Napi::Value HybridKEM::decapsulateSecret(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
+    }
+    const auto ciphertextBuffer = info[0].As<Napi::Buffer<byte>>();
+    SecureArena::Block sharedSecret = Buffers::allocateSecret(env, SHARED_SECRET_LENGTH);
+    try {
+      decapsulate({ciphertextBuffer.Data(), ciphertextBuffer.Length()}, sharedSecret.data());
+      return Buffers::fromBlock(env, std::move(sharedSecret));
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+  }
+
+  /**
+   * Asynchronously generates a hybrid keypair on a worker thread.
+   * Overwrites any existing secret key on the instance with the generated secret key.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @async
+   * @name generateKeypairAsync
+   * @returns {Promise<Buffer>} - A Promise that resolves to a Buffer containing the hybrid public key.
+   */
+  Napi::Value HybridKEM::generateKeypairAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return AsyncJob::run<Slab::Block>(
+      env,
+      {Value()},
+      [this]() -> Slab::Block {
+        Slab::Block publicKey(X25519_KEY_LENGTH + oqsKE->get_details().length_public_key);
+        generate(publicKey.data());
+        return publicKey;
+      },
+      [](Napi::Env cbEnv, Slab::Block& publicKey) -> Napi::Value {
+        const std::size_t length = publicKey.size();
+        return Buffers::fromBlock(cbEnv, std::move(publicKey), length);
+      }
+    );
+  }
+
+  /**
+   * Asynchronously encapsulates a combined shared secret on a worker thread using a provided hybrid public key.
+   * The Buffer must not be modified until the returned Promise settles.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @async
+   * @name encapsulateSecretAsync
+   * @param {Buffer} publicKey - The hybrid public key belonging to the intended recipient of the shared secret.
+   * @returns {Promise<KeyEncapsulation.CiphertextSharedSecretPair>} - A Promise that resolves to the hybrid ciphertext and combined shared secret.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value HybridKEM::encapsulateSecretAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Public key must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Public key must be a buffer");
+    }
+    const auto publicKeyBuffer = info[0].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span publicKey{publicKeyBuffer.Data(), publicKeyBuffer.Length()};
+    using EncapResult = std::pair<Slab::Block, SecureArena::Block>;
+    return AsyncJob::run<EncapResult>(
+      env,
+      {Value(), publicKeyBuffer},
+      [this, publicKey]() -> EncapResult {
+        EncapResult encapPair(
+          Slab::Block(X25519_KEY_LENGTH + oqsKE->get_details().length_ciphertext),
+          SecureArena::Block(SHARED_SECRET_LENGTH)
+        );
+        encapsulate(publicKey, encapPair.first.data(), encapPair.second.data());
+        return encapPair;
+      },
+      [](Napi::Env cbEnv, EncapResult& encapPair) -> Napi::Value {
+        const std::size_t ciphertextLength = encapPair.first.size();
+        auto ciphertextSharedSecretPair = Napi::Object::New(cbEnv);
+        ciphertextSharedSecretPair.Set(
+          Napi::String::New(cbEnv, "ciphertext"),
+          Buffers::fromBlock(cbEnv, std::move(encapPair.first), ciphertextLength)
+        );
+        ciphertextSharedSecretPair.Set(
+          Napi::String::New(cbEnv, "sharedSecret"),
+          Buffers::fromBlock(cbEnv, std::move(encapPair.second))
+        );
+        return ciphertextSharedSecretPair;
+      }
+    );
+  }
+
+  /**
+   * Asynchronously decapsulates the combined shared secret from a hybrid ciphertext on a worker thread.
+   * The Buffer must not be modified until the returned Promise settles.
+   * @memberof HybridKEM
+   * @instance
+   * @method
+   * @async
+   * @name decapsulateSecretAsync
+   * @param {Buffer} ciphertext - The hybrid ciphertext that was encrypted using the instance's public key.
+   * @returns {Promise<Buffer>} - A Promise that resolves to the combined shared secret.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value HybridKEM::decapsulateSecretAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
+    }
+    const auto ciphertextBuffer = info[0].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span ciphertext{ciphertextBuffer.Data(), ciphertextBuffer.Length()};
+    return AsyncJob::run<SecureArena::Block>(
+      env,
+      {Value(), ciphertextBuffer},
+      [this, ciphertext]() -> SecureArena::Block {
+        SecureArena::Block sharedSecret(SHARED_SECRET_LENGTH);
+        decapsulate(ciphertext, sharedSecret.data());
+        return sharedSecret;
+      },
+      [](Napi::Env cbEnv, SecureArena::Block& sharedSecret) -> Napi::Value {
+        return Buffers::fromBlock(cbEnv, std::move(sharedSecret));
+      }
+    );
+  }
+
+  void HybridKEM::Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function func = DefineClass(env, "HybridKEM", {
+      InstanceMethod<&HybridKEM::getDetails>("getDetails"),
+      InstanceMethod<&HybridKEM::generateKeypair>("generateKeypair"),
+      InstanceMethod<&HybridKEM::exportSecretKey>("exportSecretKey"),
+      InstanceMethod<&HybridKEM::encapsulateSecret>("encapsulateSecret"),
+      InstanceMethod<&HybridKEM::decapsulateSecret>("decapsulateSecret"),
+      InstanceMethod<&HybridKEM::generateKeypairAsync>("generateKeypairAsync"),
+      InstanceMethod<&HybridKEM::encapsulateSecretAsync>("encapsulateSecretAsync"),
+      InstanceMethod<&HybridKEM::decapsulateSecretAsync>("decapsulateSecretAsync")
+    });
+    exports.Set(
+      Napi::String::New(env, "HybridKEM"),
+      func
+    );
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    HybridKEM::Init(env, exports);
+  }
+
+} // namespace HybridKEM
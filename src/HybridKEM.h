@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "oqs_span.h"
+#include "SecureArena.h"
+
+namespace HybridKEM {
+
+  class HybridKEM : public Napi::ObjectWrap<HybridKEM> {
+    private:
+      std::unique_ptr<oqs_span::KeyEncapsulation> oqsKE;
+      // The X25519 secret key followed by its public key, empty until a keypair is generated or imported
+      SecureArena::Block x25519Key;
+      // Guards oqsKE and x25519Key against concurrent use by async jobs
+      std::mutex mutex;
+
+      void generate(oqs::byte* publicKey);
+      void encapsulate(oqs_span::byte_span publicKey, oqs::byte* ciphertext, oqs::byte* sharedSecret) const;
+      void decapsulate(oqs_span::byte_span ciphertext, oqs::byte* sharedSecret);
+
+    public:
+      explicit HybridKEM(const Napi::CallbackInfo& info);
+      Napi::Value getDetails(const Napi::CallbackInfo& info);
+      Napi::Value generateKeypair(const Napi::CallbackInfo& info);
+      Napi::Value exportSecretKey(const Napi::CallbackInfo& info);
+      Napi::Value encapsulateSecret(const Napi::CallbackInfo& info);
+      Napi::Value decapsulateSecret(const Napi::CallbackInfo& info);
+      Napi::Value generateKeypairAsync(const Napi::CallbackInfo& info);
+      Napi::Value encapsulateSecretAsync(const Napi::CallbackInfo& info);
+      Napi::Value decapsulateSecretAsync(const Napi::CallbackInfo& info);
+
+      static void Init(Napi::Env env, Napi::Object exports);
+  };
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
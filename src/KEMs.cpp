@@ -2,13 +2,13 @@
 
 #include "KEMs.h"
 
-#include <cstdint>
-#include <vector>
 #include <napi.h>
 
 // liboqs-cpp
 #include "oqs_cpp.h"
 
+#include "Algorithms.h"
+
 /** @namespace KEMs */
 namespace KEMs {
 
@@ -21,6 +21,7 @@ namespace KEMs {
 
   /**
    * Gets an array of KEM algorithms that were enabled at compile-time and are available for use.
+   * Every call returns the same frozen array.
    * @memberof KEMs
    * @name getEnabledAlgorithms
    * @static
@@ -29,21 +30,7 @@ namespace KEMs {
    */
   Napi::Value getEnabledAlgorithms(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    const std::vector<std::string> enabledKEMs = oqs::KEMs::get_enabled_KEMs();
-    std::size_t numDefaultKEMs = 0;
-    for (auto kem : enabledKEMs) {
-      // Not expecting any other default algorithms to be created
-      if (kem == "DEFAULT") {
-        numDefaultKEMs++;
-      }
-    }
-    auto enabledKEMsArray = Napi::Array::New(env, enabledKEMs.size() - numDefaultKEMs);
-    for (std::size_t i = 0; auto kem : enabledKEMs) {
-      if (kem != "DEFAULT") {
-        enabledKEMsArray[i++] = kem;
-      }
-    }
-    return enabledKEMsArray;
+    return Algorithms::kemNames(env);
   }
 
   /**
@@ -65,13 +52,37 @@ namespace KEMs {
       throw Napi::TypeError::New(env, "Algorithm must be a string");
     }
     const auto algorithm = info[0].As<Napi::String>().Utf8Value();
+    const auto& byName = Algorithms::kems().byName;
+    const auto entry = byName.find(algorithm);
     auto isEnabled = Napi::Boolean::New(
       env,
-      oqs::KEMs::is_KEM_enabled(algorithm)
+      entry != byName.end() && entry->second != nullptr
     );
     return isEnabled;
   }
 
+  /**
+   * Gets the details of an algorithm without constructing an instance.
+   * Every call returns the same frozen object, which is also returned by KeyEncapsulation#getDetails.
+   * @memberof KEMs
+   * @name getDetails
+   * @static
+   * @method
+   * @param {KEMs.Algorithm} algorithm - The algorithm to get the details of.
+   * @returns {Object} - An object containing the details of the KEM algorithm.
+   * @throws {TypeError} Will throw an error if any argument is invalid, or if the algorithm is not enabled.
+   */
+  Napi::Value getDetails(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    return Algorithms::kemDetails(env, info[0].As<Napi::String>().Utf8Value());
+  }
+
   void Init(Napi::Env env, Napi::Object exports) {
     auto KEMsExports = Napi::Object::New(env);
     KEMsExports.Set(
@@ -82,6 +93,10 @@ namespace KEMs {
       Napi::String::New(env, "isAlgorithmEnabled"),
       Napi::Function::New(env, isAlgorithmEnabled)
     );
+    KEMsExports.Set(
+      Napi::String::New(env, "getDetails"),
+      Napi::Function::New(env, getDetails)
+    );
     exports.Set(
       Napi::String::New(env, "KEMs"),
       KEMsExports
@@ -6,6 +6,7 @@ namespace KEMs {
 
   Napi::Value getEnabledAlgorithms(const Napi::CallbackInfo& info);
   Napi::Value isAlgorithmEnabled(const Napi::CallbackInfo& info);
+  Napi::Value getDetails(const Napi::CallbackInfo& info);
 
   void Init(Napi::Env env, Napi::Object exports);
 
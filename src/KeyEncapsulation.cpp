@@ -2,9 +2,15 @@
 
 #include "KeyEncapsulation.h"
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 #include <napi.h>
 
@@ -12,6 +18,15 @@
 #include "oqs_cpp.h"
 #include "common.h"
 
+#include "AddonData.h"
+#include "Algorithms.h"
+#include "AsyncJob.h"
+#include "Buffers.h"
+#include "KeypairBatch.h"
+#include "Parallel.h"
+#include "SecureArena.h"
+#include "Slab.h"
+
 namespace KeyEncapsulation {
 
   using oqs::byte;
@@ -24,6 +39,8 @@ namespace KeyEncapsulation {
    * @constructs KeyEncapsulation
    * @param {KEMs.Algorithm} algorithm - The KEM algorithm to use.
    * @param {Buffer} [secretKey] - An optional secret key. If not specified, use KeyEncapsulation#generateKeypair later to create a secret key.
+   *   The instance keeps its own copy of the secret key in memory that is locked into RAM where possible,
+   *   and cleanses it when the key is replaced or the instance is garbage collected.
    * @throws {TypeError} Will throw an error if any argument is invalid.
    */
   KeyEncapsulation::KeyEncapsulation(const Napi::CallbackInfo& info) : Napi::ObjectWrap<KeyEncapsulation>(info) {
@@ -40,24 +57,34 @@ namespace KeyEncapsulation {
         throw Napi::TypeError::New(env, "Secret key must be a buffer");
       }
       const auto secretKeyBuffer = info[1].As<Napi::Buffer<byte>>();
-      const auto secretKeyData = secretKeyBuffer.Data();
-      const bytes secretKeyVec(secretKeyData, secretKeyData + secretKeyBuffer.Length());
       try {
-        oqsKE = std::make_unique<oqs::KeyEncapsulation>(algorithm, secretKeyVec);
+        oqsKE = std::make_unique<oqs_span::KeyEncapsulation>(
+          algorithm,
+          oqs_span::byte_span{secretKeyBuffer.Data(), secretKeyBuffer.Length()}
+        );
       } catch (const std::exception& ex) {
         throw Napi::TypeError::New(env, ex.what());
       }
     } else {
       try {
-        oqsKE = std::make_unique<oqs::KeyEncapsulation>(algorithm);
+        oqsKE = std::make_unique<oqs_span::KeyEncapsulation>(algorithm);
       } catch (const std::exception& ex) {
         throw Napi::TypeError::New(env, ex.what());
       }
     }
   }
 
+  /**
+   * Replaces the instance's secret key with one already held natively, so that it never passes through a Buffer.
+   */
+  void KeyEncapsulation::adoptSecretKey(SecureArena::Block&& secretKey) {
+    std::lock_guard<std::mutex> lock(mutex);
+    oqsKE->set_secret_key(std::move(secretKey));
+  }
+
   /**
    * Gets the details for the KEM algorithm that the instance was constructed with.
+   * The object is frozen and shared with KEMs.getDetails.
    * @memberof KeyEncapsulation
    * @instance
    * @method
@@ -66,41 +93,7 @@ namespace KeyEncapsulation {
    */
   Napi::Value KeyEncapsulation::getDetails(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    const oqs::KeyEncapsulation::KeyEncapsulationDetails details = oqsKE->get_details();
-    auto detailsObj = Napi::Object::New(env);
-    detailsObj.Set(
-      Napi::String::New(env, "name"),
-      Napi::String::New(env, details.name)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "version"),
-      Napi::String::New(env, details.version)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "claimedNistLevel"),
-      Napi::Number::New(env, details.claimed_nist_level)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "isINDCCA"),
-      Napi::Boolean::New(env, details.is_ind_cca)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "publicKeyLength"),
-      Napi::Number::New(env, details.length_public_key)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "secretKeyLength"),
-      Napi::Number::New(env, details.length_secret_key)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "ciphertextLength"),
-      Napi::Number::New(env, details.length_ciphertext)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "sharedSecretLength"),
-      Napi::Number::New(env, details.length_shared_secret)
-    );
-    return detailsObj;
+    return Algorithms::kemDetails(env, oqsKE->get_details().name);
   }
 
   /**
@@ -115,25 +108,12 @@ namespace KeyEncapsulation {
   Napi::Value KeyEncapsulation::generateKeypair(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     try {
-      const bytes publicKeyVec = oqsKE->generate_keypair();
-      bytes* publicKeyVecCopy = new (std::nothrow) bytes(publicKeyVec);
-      if (publicKeyVecCopy == nullptr) {
-        throw Napi::Error::New(env, "Failed to allocate memory");
-      }
-      Napi::MemoryManagement::AdjustExternalMemory(env, publicKeyVecCopy->size());
-      return Napi::Buffer<byte>::New(
-        env,
-        publicKeyVecCopy->data(),
-        publicKeyVecCopy->size(),
-        [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-          if (vec != nullptr) {
-            Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-            // No need to secure free public key
-          }
-          delete vec;
-        },
-        publicKeyVecCopy
-      );
+      const std::size_t publicKeyLength = oqsKE->get_details().length_public_key;
+      Slab::Block publicKey = Buffers::allocatePublic(env, publicKeyLength);
+      std::unique_lock<std::mutex> lock(mutex);
+      oqsKE->generate_keypair(publicKey.data());
+      lock.unlock();
+      return Buffers::fromBlock(env, std::move(publicKey), publicKeyLength);
     } catch (const std::exception& ex) {
       throw Napi::Error::New(env, ex.what());
     }
@@ -150,26 +130,9 @@ namespace KeyEncapsulation {
    */
   Napi::Value KeyEncapsulation::exportSecretKey(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    bytes secretKeyVec = oqsKE->export_secret_key();
-    bytes* secretKeyVecCopy = new (std::nothrow) bytes(secretKeyVec);
-    oqs::mem_cleanse(secretKeyVec);
-    if (secretKeyVecCopy == nullptr) {
-      throw Napi::Error::New(env, "Failed to allocate memory");
-    }
-    Napi::MemoryManagement::AdjustExternalMemory(env, secretKeyVecCopy->size());
-    return Napi::Buffer<byte>::New(
-      env,
-      secretKeyVecCopy->data(),
-      secretKeyVecCopy->size(),
-      [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-        if (vec != nullptr) {
-          Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-          oqs::mem_cleanse(*vec);
-        }
-        delete vec;
-      },
-      secretKeyVecCopy
-    );
+    std::lock_guard<std::mutex> lock(mutex);
+    const oqs_span::byte_span secretKey = oqsKE->secret_key();
+    return Buffers::copySecret(env, secretKey.data, secretKey.size);
   }
 
   /**
@@ -200,51 +163,19 @@ namespace KeyEncapsulation {
       throw Napi::TypeError::New(env, "Public key must be a buffer");
     }
     const auto publicKeyBuffer = info[0].As<Napi::Buffer<byte>>();
-    const auto publicKeyData = publicKeyBuffer.Data();
-    const bytes publicKeyVec(publicKeyData, publicKeyData + publicKeyBuffer.Length());
+    const auto& details = oqsKE->get_details();
+    SecureArena::Block sharedSecret = Buffers::allocateSecret(env, details.length_shared_secret);
     try {
-      std::pair<bytes, bytes> encapPair = oqsKE->encap_secret(publicKeyVec);
-      bytes* ciphertextVec = new (std::nothrow) bytes(encapPair.first);
-      bytes* sharedSecretVec = new (std::nothrow) bytes(encapPair.second);
-      // Secure free shared secret returned by OQS
-      oqs::mem_cleanse(encapPair.second);
-      if (ciphertextVec == nullptr || sharedSecretVec == nullptr) {
-        throw Napi::Error::New(env, "Failed to allocate memory");
-      }
-      Napi::MemoryManagement::AdjustExternalMemory(env, ciphertextVec->size());
-      Napi::MemoryManagement::AdjustExternalMemory(env, sharedSecretVec->size());
+      Slab::Block ciphertext = Buffers::allocatePublic(env, details.length_ciphertext);
+      oqsKE->encap_secret({publicKeyBuffer.Data(), publicKeyBuffer.Length()}, ciphertext.data(), sharedSecret.data());
       auto ciphertextSharedSecretPair = Napi::Object::New(env);
       ciphertextSharedSecretPair.Set(
         Napi::String::New(env, "ciphertext"),
-        Napi::Buffer<byte>::New(
-          env,
-          ciphertextVec->data(),
-          ciphertextVec->size(),
-          [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-            if (vec != nullptr) {
-              Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-              // No need to secure free ciphertext
-            }
-            delete vec;
-          },
-          ciphertextVec
-        )
+        Buffers::fromBlock(env, std::move(ciphertext), details.length_ciphertext)
       );
       ciphertextSharedSecretPair.Set(
         Napi::String::New(env, "sharedSecret"),
-        Napi::Buffer<byte>::New(
-          env,
-          sharedSecretVec->data(),
-          sharedSecretVec->size(),
-          [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-            if (vec != nullptr) {
-              Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-              oqs::mem_cleanse(*vec);
-            }
-            delete vec;
-          },
-          sharedSecretVec
-        )
+        Buffers::fromBlock(env, std::move(sharedSecret))
       );
       return ciphertextSharedSecretPair;
     } catch (const std::exception& ex) {
@@ -272,50 +203,397 @@ namespace KeyEncapsulation {
       throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
     }
     const auto ciphertextBuffer = info[0].As<Napi::Buffer<byte>>();
-    const auto ciphertextData = ciphertextBuffer.Data();
-    const bytes ciphertextVec(ciphertextData, ciphertextData + ciphertextBuffer.Length());
+    SecureArena::Block sharedSecret = Buffers::allocateSecret(env, oqsKE->get_details().length_shared_secret);
     try {
-      bytes sharedSecretVec = oqsKE->decap_secret(ciphertextVec);
-      bytes* sharedSecretVecCopy = new (std::nothrow) bytes(sharedSecretVec);
-      // Secure free shared secret returned by OQS
-      oqs::mem_cleanse(sharedSecretVec);
-      if (sharedSecretVecCopy == nullptr) {
-        throw Napi::Error::New(env, "Failed to allocate memory");
+      std::unique_lock<std::mutex> lock(mutex);
+      oqsKE->decap_secret({ciphertextBuffer.Data(), ciphertextBuffer.Length()}, sharedSecret.data());
+      lock.unlock();
+      return Buffers::fromBlock(env, std::move(sharedSecret));
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+  }
+
+  /**
+   * Asynchronously generates a keypair on a worker thread.
+   * Overwrites any existing secret key on the instance with the generated secret key.
+   * @memberof KeyEncapsulation
+   * @instance
+   * @method
+   * @async
+   * @name generateKeypairAsync
+   * @returns {Promise<Buffer>} - A Promise that resolves to a Buffer containing the public key.
+   */
+  Napi::Value KeyEncapsulation::generateKeypairAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return AsyncJob::run<Slab::Block>(
+      env,
+      {Value()},
+      [this]() -> Slab::Block {
+        Slab::Block publicKey(oqsKE->get_details().length_public_key);
+        std::lock_guard<std::mutex> lock(mutex);
+        oqsKE->generate_keypair(publicKey.data());
+        return publicKey;
+      },
+      [](Napi::Env cbEnv, Slab::Block& publicKey) -> Napi::Value {
+        const std::size_t length = publicKey.size();
+        return Buffers::fromBlock(cbEnv, std::move(publicKey), length);
       }
-      Napi::MemoryManagement::AdjustExternalMemory(env, sharedSecretVecCopy->size());
-      return Napi::Buffer<byte>::New(
-        env,
-        sharedSecretVecCopy->data(),
-        sharedSecretVecCopy->size(),
-        [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-          if (vec != nullptr) {
-            Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-            oqs::mem_cleanse(*vec);
-          }
-          delete vec;
-        },
-        sharedSecretVecCopy
-      );
+    );
+  }
+
+  /**
+   * Asynchronously encapsulates the shared secret on a worker thread using a provided public key.
+   * The Buffer must not be modified until the returned Promise settles.
+   * @memberof KeyEncapsulation
+   * @instance
+   * @method
+   * @async
+   * @name encapsulateSecretAsync
+   * @param {Buffer} publicKey - The public key belonging to the intended recipient of the shared secret.
+   * @returns {Promise<KeyEncapsulation.CiphertextSharedSecretPair>} - A Promise that resolves to the ciphertext and shared secret.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value KeyEncapsulation::encapsulateSecretAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Public key must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Public key must be a buffer");
+    }
+    const auto publicKeyBuffer = info[0].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span publicKey{publicKeyBuffer.Data(), publicKeyBuffer.Length()};
+    using EncapResult = std::pair<Slab::Block, SecureArena::Block>;
+    return AsyncJob::run<EncapResult>(
+      env,
+      {Value(), publicKeyBuffer},
+      [this, publicKey]() -> EncapResult {
+        const auto& details = oqsKE->get_details();
+        EncapResult encapPair(
+          Slab::Block(details.length_ciphertext),
+          SecureArena::Block(details.length_shared_secret)
+        );
+        oqsKE->encap_secret(publicKey, encapPair.first.data(), encapPair.second.data());
+        return encapPair;
+      },
+      [](Napi::Env cbEnv, EncapResult& encapPair) -> Napi::Value {
+        const std::size_t ciphertextLength = encapPair.first.size();
+        auto ciphertextSharedSecretPair = Napi::Object::New(cbEnv);
+        ciphertextSharedSecretPair.Set(
+          Napi::String::New(cbEnv, "ciphertext"),
+          Buffers::fromBlock(cbEnv, std::move(encapPair.first), ciphertextLength)
+        );
+        ciphertextSharedSecretPair.Set(
+          Napi::String::New(cbEnv, "sharedSecret"),
+          Buffers::fromBlock(cbEnv, std::move(encapPair.second))
+        );
+        return ciphertextSharedSecretPair;
+      }
+    );
+  }
+
+  /**
+   * Asynchronously decapsulates the shared secret on a worker thread.
+   * The Buffer must not be modified until the returned Promise settles.
+   * @memberof KeyEncapsulation
+   * @instance
+   * @method
+   * @async
+   * @name decapsulateSecretAsync
+   * @param {Buffer} ciphertext - The ciphertext that was encrypted using the instance's public key.
+   * @returns {Promise<Buffer>} - A Promise that resolves to the shared secret.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value KeyEncapsulation::decapsulateSecretAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Ciphertext must be a buffer");
+    }
+    const auto ciphertextBuffer = info[0].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span ciphertext{ciphertextBuffer.Data(), ciphertextBuffer.Length()};
+    return AsyncJob::run<SecureArena::Block>(
+      env,
+      {Value(), ciphertextBuffer},
+      [this, ciphertext]() -> SecureArena::Block {
+        SecureArena::Block sharedSecret(oqsKE->get_details().length_shared_secret);
+        std::lock_guard<std::mutex> lock(mutex);
+        oqsKE->decap_secret(ciphertext, sharedSecret.data());
+        return sharedSecret;
+      },
+      [](Napi::Env cbEnv, SecureArena::Block& sharedSecret) -> Napi::Value {
+        return Buffers::fromBlock(cbEnv, std::move(sharedSecret));
+      }
+    );
+  }
+
+  /**
+   * An object with the following properties:
+   * * `ciphertexts`: The ciphertexts for every public key, concatenated in order.
+   *   The ciphertext for the i-th public key starts at offset `i * ciphertextLength`.
+   * * `sharedSecrets`: The shared secrets for every public key, concatenated in order.
+   *   The shared secret for the i-th public key starts at offset `i * sharedSecretLength`.
+   * * `ciphertextLength`: The length of each ciphertext.
+   * * `sharedSecretLength`: The length of each shared secret.
+   * @memberof KeyEncapsulation
+   * @typedef {Object} CiphertextSharedSecretBatch
+   */
+
+  /**
+   * Packed output of a multi-recipient encapsulation.
+   */
+  struct EncapBatch {
+    std::unique_ptr<bytes> ciphertexts;
+    SecureArena::Block sharedSecrets;
+    std::size_t ciphertextLength;
+    std::size_t sharedSecretLength;
+  };
+
+  /**
+   * Reads the public keys passed to a multi-recipient encapsulation method.
+   * Every Buffer that the returned spans point into is appended to `buffers`.
+   */
+  static std::vector<oqs_span::byte_span> parsePublicKeys(const Napi::CallbackInfo& info, std::vector<Napi::Object>& buffers) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Public keys must be an array of buffers");
+    }
+    if (!info[0].IsArray()) {
+      throw Napi::TypeError::New(env, "Public keys must be an array of buffers");
+    }
+    const auto publicKeys = info[0].As<Napi::Array>();
+    std::vector<oqs_span::byte_span> publicKeySpans(publicKeys.Length());
+    buffers.reserve(buffers.size() + publicKeySpans.size());
+    for (std::uint32_t i = 0; i < publicKeys.Length(); i++) {
+      const Napi::Value publicKeyValue = publicKeys.Get(i);
+      if (!publicKeyValue.IsBuffer()) {
+        throw Napi::TypeError::New(env, "Public keys must be an array of buffers");
+      }
+      const auto publicKeyBuffer = publicKeyValue.As<Napi::Buffer<byte>>();
+      publicKeySpans[i] = {publicKeyBuffer.Data(), publicKeyBuffer.Length()};
+      buffers.push_back(publicKeyBuffer);
+    }
+    return publicKeySpans;
+  }
+
+  /**
+   * Encapsulates a shared secret for every public key in parallel.
+   * Throws if encapsulation fails for any public key.
+   */
+  static EncapBatch encapsulateMany(const oqs_span::KeyEncapsulation& oqsKE, const std::vector<oqs_span::byte_span>& publicKeys) {
+    const auto details = oqsKE.get_details();
+    EncapBatch batch;
+    batch.ciphertextLength = details.length_ciphertext;
+    batch.sharedSecretLength = details.length_shared_secret;
+    batch.ciphertexts = std::make_unique<bytes>(publicKeys.size() * batch.ciphertextLength);
+    batch.sharedSecrets = SecureArena::Block(publicKeys.size() * batch.sharedSecretLength);
+    std::atomic<bool> failed(false);
+    std::string error;
+    std::mutex errorMutex;
+    Parallel::forEach(publicKeys.size(), [&](std::size_t i) -> void {
+      if (failed.load(std::memory_order_relaxed)) {
+        return;
+      }
+      try {
+        oqsKE.encap_secret(
+          publicKeys[i],
+          batch.ciphertexts->data() + i * batch.ciphertextLength,
+          batch.sharedSecrets.data() + i * batch.sharedSecretLength
+        );
+      } catch (const std::exception& ex) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!failed.exchange(true)) {
+          error = ex.what();
+        }
+      }
+    });
+    if (failed.load()) {
+      // The shared secrets are cleansed as the batch is destroyed
+      throw std::runtime_error(error);
+    }
+    return batch;
+  }
+
+  /**
+   * Converts the packed output of a multi-recipient encapsulation into a JS object.
+   */
+  static Napi::Value encapBatchToObject(Napi::Env env, EncapBatch& batch) {
+    auto batchObj = Napi::Object::New(env);
+    batchObj.Set(
+      Napi::String::New(env, "ciphertexts"),
+      Buffers::fromBytes(env, std::move(batch.ciphertexts), false)
+    );
+    batchObj.Set(
+      Napi::String::New(env, "sharedSecrets"),
+      Buffers::fromBlock(env, std::move(batch.sharedSecrets))
+    );
+    batchObj.Set(
+      Napi::String::New(env, "ciphertextLength"),
+      Napi::Number::New(env, batch.ciphertextLength)
+    );
+    batchObj.Set(
+      Napi::String::New(env, "sharedSecretLength"),
+      Napi::Number::New(env, batch.sharedSecretLength)
+    );
+    return batchObj;
+  }
+
+  /**
+   * Encapsulates a shared secret for each of several public keys in one call, spreading the work over the threads of the {@link ThreadPool}.
+   * @memberof KeyEncapsulation
+   * @instance
+   * @method
+   * @name encapsulateSecretMany
+   * @param {Buffer[]} publicKeys - The public keys belonging to the intended recipients of the shared secrets.
+   * @returns {KeyEncapsulation.CiphertextSharedSecretBatch} - The packed ciphertexts and shared secrets.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if memory cannot be allocated.
+   */
+  Napi::Value KeyEncapsulation::encapsulateSecretMany(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<Napi::Object> buffers;
+    const std::vector<oqs_span::byte_span> publicKeys = parsePublicKeys(info, buffers);
+    try {
+      EncapBatch batch = encapsulateMany(*oqsKE, publicKeys);
+      return encapBatchToObject(env, batch);
     } catch (const std::exception& ex) {
       throw Napi::TypeError::New(env, ex.what());
     }
   }
 
+  /**
+   * Asynchronously encapsulates a shared secret for each of several public keys, spreading the work over the threads of the {@link ThreadPool}.
+   * The Buffers must not be modified until the returned Promise settles.
+   * @memberof KeyEncapsulation
+   * @instance
+   * @method
+   * @async
+   * @name encapsulateSecretManyAsync
+   * @param {Buffer[]} publicKeys - The public keys belonging to the intended recipients of the shared secrets.
+   * @returns {Promise<KeyEncapsulation.CiphertextSharedSecretBatch>} - A Promise that resolves to the packed ciphertexts and shared secrets.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value KeyEncapsulation::encapsulateSecretManyAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<Napi::Object> buffers;
+    const std::vector<oqs_span::byte_span> publicKeys = parsePublicKeys(info, buffers);
+    buffers.push_back(Value());
+    return AsyncJob::run<EncapBatch>(
+      env,
+      buffers,
+      [this, publicKeys]() -> EncapBatch {
+        return encapsulateMany(*oqsKE, publicKeys);
+      },
+      [](Napi::Env cbEnv, EncapBatch& batch) -> Napi::Value {
+        return encapBatchToObject(cbEnv, batch);
+      }
+    );
+  }
+
+  /**
+   * An object with the following properties:
+   * * `publicKeys`: The public keys, concatenated in order. The i-th public key starts at offset `i * publicKeyLength`.
+   * * `secretKeys`: The secret keys, concatenated in order, in memory that is locked into RAM where possible
+   *   and cleansed when the Buffer is garbage collected. The i-th secret key starts at offset `i * secretKeyLength`.
+   * * `publicKeyLength`: The length of each public key.
+   * * `secretKeyLength`: The length of each secret key.
+   * * `count`: The number of keypairs.
+   * @memberof KeyEncapsulation
+   * @typedef {Object} KeypairBatch
+   */
+
+  /**
+   * Generates many keypairs in one call, spreading the work over the threads of the {@link ThreadPool}.
+   * The keys are packed into one public key Buffer and one secret key Buffer, rather than needing an instance,
+   * a generateKeypair call and an exportSecretKey call per keypair.
+   * @memberof KeyEncapsulation
+   * @name generateKeypairs
+   * @static
+   * @method
+   * @param {KEMs.Algorithm} algorithm - The KEM algorithm to use.
+   * @param {number} count - The number of keypairs to generate.
+   * @returns {KeyEncapsulation.KeypairBatch} - The packed public and secret keys.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if memory cannot be allocated or key generation fails.
+   */
+  Napi::Value KeyEncapsulation::generateKeypairs(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::string algorithm;
+    std::size_t count;
+    KeypairBatch::parseArguments(info, algorithm, count);
+    std::unique_ptr<oqs_span::KeyEncapsulation> scheme;
+    try {
+      scheme = std::make_unique<oqs_span::KeyEncapsulation>(algorithm);
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+    try {
+      KeypairBatch::Batch batch = KeypairBatch::generate(*scheme, count);
+      return KeypairBatch::toObject(env, batch);
+    } catch (const std::exception& ex) {
+      throw Napi::Error::New(env, ex.what());
+    }
+  }
+
+  /**
+   * Asynchronously generates many keypairs, spreading the work over the threads of the {@link ThreadPool}
+   * without blocking the event loop.
+   * @memberof KeyEncapsulation
+   * @name generateKeypairsAsync
+   * @static
+   * @method
+   * @async
+   * @param {KEMs.Algorithm} algorithm - The KEM algorithm to use.
+   * @param {number} count - The number of keypairs to generate.
+   * @returns {Promise<KeyEncapsulation.KeypairBatch>} - A Promise that resolves to the packed public and secret keys.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value KeyEncapsulation::generateKeypairsAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::string algorithm;
+    std::size_t count;
+    KeypairBatch::parseArguments(info, algorithm, count);
+    std::shared_ptr<const oqs_span::KeyEncapsulation> scheme;
+    try {
+      scheme = std::make_shared<const oqs_span::KeyEncapsulation>(algorithm);
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+    return AsyncJob::run<KeypairBatch::Batch>(
+      env,
+      {},
+      [scheme, count]() -> KeypairBatch::Batch {
+        return KeypairBatch::generate(*scheme, count);
+      },
+      [](Napi::Env cbEnv, KeypairBatch::Batch& batch) -> Napi::Value {
+        return KeypairBatch::toObject(cbEnv, batch);
+      }
+    );
+  }
+
   void KeyEncapsulation::Init(Napi::Env env, Napi::Object exports) {
     Napi::Function func = DefineClass(env, "KeyEncapsulation", {
       InstanceMethod<&KeyEncapsulation::getDetails>("getDetails"),
       InstanceMethod<&KeyEncapsulation::generateKeypair>("generateKeypair"),
       InstanceMethod<&KeyEncapsulation::exportSecretKey>("exportSecretKey"),
       InstanceMethod<&KeyEncapsulation::encapsulateSecret>("encapsulateSecret"),
-      InstanceMethod<&KeyEncapsulation::decapsulateSecret>("decapsulateSecret")
+      InstanceMethod<&KeyEncapsulation::decapsulateSecret>("decapsulateSecret"),
+      InstanceMethod<&KeyEncapsulation::generateKeypairAsync>("generateKeypairAsync"),
+      InstanceMethod<&KeyEncapsulation::encapsulateSecretAsync>("encapsulateSecretAsync"),
+      InstanceMethod<&KeyEncapsulation::decapsulateSecretAsync>("decapsulateSecretAsync"),
+      InstanceMethod<&KeyEncapsulation::encapsulateSecretMany>("encapsulateSecretMany"),
+      InstanceMethod<&KeyEncapsulation::encapsulateSecretManyAsync>("encapsulateSecretManyAsync"),
+      StaticMethod<&KeyEncapsulation::generateKeypairs>("generateKeypairs"),
+      StaticMethod<&KeyEncapsulation::generateKeypairsAsync>("generateKeypairsAsync")
     });
-    Napi::FunctionReference* constructor = new Napi::FunctionReference();
-    *constructor = Napi::Persistent(func);
+    AddonData::get(env).keyEncapsulationConstructor = Napi::Persistent(func);
     exports.Set(
       Napi::String::New(env, "KeyEncapsulation"),
       func
     );
-    env.SetInstanceData<Napi::FunctionReference>(constructor);
   }
 
   void Init(Napi::Env env, Napi::Object exports) {
@@ -1,16 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <napi.h>
 
 // liboqs-cpp
 #include "oqs_cpp.h"
 
+#include "SecureArena.h"
+#include "oqs_span.h"
+
 namespace KeyEncapsulation {
 
   class KeyEncapsulation : public Napi::ObjectWrap<KeyEncapsulation> {
     private:
-      std::unique_ptr<oqs::KeyEncapsulation> oqsKE;
+      std::unique_ptr<oqs_span::KeyEncapsulation> oqsKE;
+      // Guards oqsKE against concurrent use by async jobs
+      std::mutex mutex;
 
     public:
       explicit KeyEncapsulation(const Napi::CallbackInfo& info);
@@ -19,6 +25,16 @@ namespace KeyEncapsulation {
       Napi::Value exportSecretKey(const Napi::CallbackInfo& info);
       Napi::Value encapsulateSecret(const Napi::CallbackInfo& info);
       Napi::Value decapsulateSecret(const Napi::CallbackInfo& info);
+      Napi::Value generateKeypairAsync(const Napi::CallbackInfo& info);
+      Napi::Value encapsulateSecretAsync(const Napi::CallbackInfo& info);
+      Napi::Value decapsulateSecretAsync(const Napi::CallbackInfo& info);
+      Napi::Value encapsulateSecretMany(const Napi::CallbackInfo& info);
+      Napi::Value encapsulateSecretManyAsync(const Napi::CallbackInfo& info);
+
+      void adoptSecretKey(SecureArena::Block&& secretKey);
+
+      static Napi::Value generateKeypairs(const Napi::CallbackInfo& info);
+      static Napi::Value generateKeypairsAsync(const Napi::CallbackInfo& info);
 
       static void Init(Napi::Env env, Napi::Object exports);
   };
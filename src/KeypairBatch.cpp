@@ -0,0 +1,62 @@
+#include "KeypairBatch.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <napi.h>
+
+#include "Buffers.h"
+
+namespace KeypairBatch {
+
+  // Large enough for any provisioning job, small enough that the packed sizes cannot overflow
+  static constexpr std::size_t MAX_COUNT = 1 << 24;
+
+  void parseArguments(const Napi::CallbackInfo& info, std::string& algorithm, std::size_t& count) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (info.Length() < 2) {
+      throw Napi::TypeError::New(env, "Count must be a number");
+    }
+    if (!info[1].IsNumber()) {
+      throw Napi::TypeError::New(env, "Count must be a number");
+    }
+    const double value = info[1].As<Napi::Number>().DoubleValue();
+    if (!(value >= 0 && value <= MAX_COUNT) || value != static_cast<double>(static_cast<std::size_t>(value))) {
+      throw Napi::TypeError::New(env, "Count must be an integer from 0 to " + std::to_string(MAX_COUNT));
+    }
+    algorithm = info[0].As<Napi::String>().Utf8Value();
+    count = static_cast<std::size_t>(value);
+  }
+
+  Napi::Value toObject(Napi::Env env, Batch& batch) {
+    auto batchObj = Napi::Object::New(env);
+    batchObj.Set(
+      Napi::String::New(env, "publicKeys"),
+      Buffers::fromBytes(env, std::move(batch.publicKeys), false)
+    );
+    batchObj.Set(
+      Napi::String::New(env, "secretKeys"),
+      Buffers::fromBlock(env, std::move(batch.secretKeys))
+    );
+    batchObj.Set(
+      Napi::String::New(env, "publicKeyLength"),
+      Napi::Number::New(env, batch.publicKeyLength)
+    );
+    batchObj.Set(
+      Napi::String::New(env, "secretKeyLength"),
+      Napi::Number::New(env, batch.secretKeyLength)
+    );
+    batchObj.Set(
+      Napi::String::New(env, "count"),
+      Napi::Number::New(env, batch.count)
+    );
+    return batchObj;
+  }
+
+} // namespace KeypairBatch
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "Parallel.h"
+#include "SecureArena.h"
+
+/**
+ * Bulk keypair generation shared by KeyEncapsulation.generateKeypairs and Signature.generateKeypairs.
+ */
+namespace KeypairBatch {
+
+  /**
+   * Keypairs packed with a fixed stride: the i-th public key starts at `i * publicKeyLength`
+   * and the i-th secret key at `i * secretKeyLength`.
+   */
+  struct Batch {
+    std::unique_ptr<oqs::bytes> publicKeys;
+    SecureArena::Block secretKeys;
+    std::size_t publicKeyLength;
+    std::size_t secretKeyLength;
+    std::size_t count;
+  };
+
+  /**
+   * Reads the algorithm and count arguments of a generateKeypairs method.
+   */
+  void parseArguments(const Napi::CallbackInfo& info, std::string& algorithm, std::size_t& count);
+
+  /**
+   * Converts a batch into a JS object, handing its memory over to Buffers.
+   */
+  Napi::Value toObject(Napi::Env env, Batch& batch);
+
+  /**
+   * Generates `count` keypairs straight into a batch, spreading the work over the addon's thread pool.
+   * `Scheme` is oqs_span::KeyEncapsulation or oqs_span::Signature.
+   * Throws if generation fails for any keypair; the secret keys generated so far are cleansed.
+   */
+  template <typename Scheme>
+  Batch generate(const Scheme& scheme, std::size_t count) {
+    const auto& details = scheme.get_details();
+    Batch batch;
+    batch.publicKeyLength = details.length_public_key;
+    batch.secretKeyLength = details.length_secret_key;
+    batch.count = count;
+    batch.publicKeys = std::make_unique<oqs::bytes>(count * batch.publicKeyLength);
+    batch.secretKeys = SecureArena::Block(count * batch.secretKeyLength);
+    std::atomic<bool> failed(false);
+    std::string error;
+    std::mutex errorMutex;
+    Parallel::forEach(count, [&](std::size_t i) -> void {
+      if (failed.load(std::memory_order_relaxed)) {
+        return;
+      }
+      try {
+        scheme.generate_keypair(
+          batch.publicKeys->data() + i * batch.publicKeyLength,
+          batch.secretKeys.data() + i * batch.secretKeyLength
+        );
+      } catch (const std::exception& ex) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!failed.exchange(true)) {
+          error = ex.what();
+        }
+      }
+    });
+    if (failed.load()) {
+      throw std::runtime_error(error);
+    }
+    return batch;
+  }
+
+}
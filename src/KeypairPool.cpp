@@ -0,0 +1,315 @@
+// exports.KeypairPool
+
+#include "KeypairPool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+#include "common.h"
+
+#include "AddonData.h"
+#include "Buffers.h"
+#include "KeyEncapsulation.h"
+#include "SecureArena.h"
+#include "ThreadPool.h"
+#include "oqs_span.h"
+
+namespace KeypairPool {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  static constexpr std::size_t DEFAULT_LOW = 2;
+  static constexpr std::size_t DEFAULT_HIGH = 8;
+  static constexpr std::size_t MAX_HIGH = 65536;
+
+  struct Keypair {
+    bytes publicKey;
+    // Kept in the SecureArena while the keypair waits in the reservoir, and cleansed when released
+    SecureArena::Block secretKey;
+  };
+
+  /**
+   * The keypairs of a pool and the state of its refill.
+   * Refilling starts once fewer than `low` keypairs are ready and stops once `high` are.
+   */
+  struct Reservoir {
+    // Only used through const methods, so it is safe to share between refill tasks
+    std::unique_ptr<oqs_span::KeyEncapsulation> kem;
+    std::size_t low;
+    std::size_t high;
+    // Guards everything below
+    std::mutex mutex;
+    std::deque<Keypair> keypairs;
+    std::size_t inFlight;
+    bool refilling;
+    bool closed;
+  };
+
+  static Keypair generateKeypair(const oqs_span::KeyEncapsulation& kem) {
+    const auto& details = kem.get_details();
+    Keypair keypair{bytes(details.length_public_key, 0), SecureArena::Block(details.length_secret_key)};
+    kem.generate_keypair(keypair.publicKey.data(), keypair.secretKey.data());
+    return keypair;
+  }
+
+  static void schedule(const std::shared_ptr<Reservoir>& reservoir);
+
+  /**
+   * Generates one keypair on a worker thread and adds it to the reservoir.
+   */
+  static void refillOne(const std::shared_ptr<Reservoir>& reservoir) {
+    Keypair keypair;
+    bool generated = true;
+    try {
+      keypair = generateKeypair(*reservoir->kem);
+    } catch (const std::exception&) {
+      generated = false;
+    }
+    std::lock_guard<std::mutex> lock(reservoir->mutex);
+    reservoir->inFlight--;
+    if (!generated) {
+      // Retrying would most likely fail the same way, so wait for the next take()
+      reservoir->refilling = false;
+      return;
+    }
+    if (reservoir->closed) {
+      return;
+    }
+    reservoir->keypairs.push_back(std::move(keypair));
+    if (reservoir->keypairs.size() >= reservoir->high) {
+      reservoir->refilling = false;
+    }
+    schedule(reservoir);
+  }
+
+  /**
+   * Starts refilling if the reservoir is low, and keeps enough refill tasks queued while it is refilling.
+   * At most half of the thread pool is used, so that other asynchronous work is not starved.
+   * Must be called with the reservoir's mutex held.
+   */
+  static void schedule(const std::shared_ptr<Reservoir>& reservoir) {
+    if (reservoir->closed) {
+      return;
+    }
+    if (reservoir->keypairs.size() < reservoir->low) {
+      reservoir->refilling = true;
+    }
+    if (!reservoir->refilling) {
+      return;
+    }
+    const std::size_t maxInFlight = std::max<std::size_t>(ThreadPool::concurrency() / 2, 1);
+    while (reservoir->keypairs.size() + reservoir->inFlight < reservoir->high && reservoir->inFlight < maxInFlight) {
+      reservoir->inFlight++;
+      ThreadPool::submit([reservoir]() -> void {
+        refillOne(reservoir);
+      });
+    }
+  }
+
+  /**
+   * Reads an optional non-negative integer option.
+   */
+  static std::size_t getSizeOption(Napi::Env env, Napi::Object options, const char* name, std::size_t defaultValue) {
+    const auto value = options.Get(name);
+    if (value.IsUndefined()) {
+      return defaultValue;
+    }
+    if (!value.IsNumber()) {
+      throw Napi::TypeError::New(env, std::string(name) + " must be a number");
+    }
+    const double number = value.As<Napi::Number>().DoubleValue();
+    if (!(number >= 0 && number <= MAX_HIGH) || number != static_cast<double>(static_cast<std::int64_t>(number))) {
+      throw Napi::TypeError::New(env, std::string(name) + " must be an integer from 0 to " + std::to_string(MAX_HIGH));
+    }
+    return static_cast<std::size_t>(number);
+  }
+
+  /**
+   * Options for a KeypairPool.
+   * @memberof KeypairPool
+   * @typedef {Object} Options
+   * @property {number} [low=2] - When fewer keypairs than this are ready, the pool starts generating more.
+   * @property {number} [high=8] - The pool stops generating keypairs once this many are ready.
+   */
+
+  /**
+   * Constructs an instance of KeypairPool, which keeps keypairs of a KEM algorithm generated ahead of time,
+   * so that slow key generation is kept out of latency-sensitive code such as handshakes.
+   * Keypairs are generated on the threads of the {@link ThreadPool}.
+   * @name KeypairPool
+   * @class
+   * @constructs KeypairPool
+   * @param {KEMs.Algorithm} algorithm - The KEM algorithm to use.
+   * @param {KeypairPool.Options} [options] - How many keypairs to keep ready.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  KeypairPool::KeypairPool(const Napi::CallbackInfo& info) : Napi::ObjectWrap<KeypairPool>(info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    algorithm = info[0].As<Napi::String>().Utf8Value();
+    std::size_t low = DEFAULT_LOW;
+    std::size_t high = DEFAULT_HIGH;
+    if (info.Length() >= 2 && !info[1].IsUndefined()) {
+      if (!info[1].IsObject()) {
+        throw Napi::TypeError::New(env, "Options must be an object");
+      }
+      const auto optionsObj = info[1].As<Napi::Object>();
+      low = getSizeOption(env, optionsObj, "low", DEFAULT_LOW);
+      high = getSizeOption(env, optionsObj, "high", std::max(DEFAULT_HIGH, low));
+    }
+    if (high < 1 || low > high) {
+      throw Napi::TypeError::New(env, "high must be at least 1 and at least low");
+    }
+    reservoir = std::make_shared<Reservoir>();
+    try {
+      reservoir->kem = std::make_unique<oqs_span::KeyEncapsulation>(algorithm);
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+    reservoir->low = low;
+    reservoir->high = high;
+    reservoir->inFlight = 0;
+    reservoir->refilling = false;
+    reservoir->closed = false;
+    std::lock_guard<std::mutex> lock(reservoir->mutex);
+    // Fill up to high straight away, not just to low
+    reservoir->refilling = true;
+    schedule(reservoir);
+  }
+
+  /**
+   * Stops refilling and wipes the secret keys of the keypairs that were never taken.
+   */
+  static void closeReservoir(Reservoir& reservoir) {
+    std::lock_guard<std::mutex> lock(reservoir.mutex);
+    reservoir.closed = true;
+    // Releasing the secret keys to the arena cleanses them
+    reservoir.keypairs.clear();
+  }
+
+  KeypairPool::~KeypairPool() {
+    if (reservoir) {
+      closeReservoir(*reservoir);
+    }
+  }
+
+  /**
+   * A keypair taken from a KeypairPool.
+   * @memberof KeypairPool
+   * @typedef {Object} PooledKeypair
+   * @property {Buffer} publicKey - The public key.
+   * @property {KeyEncapsulation} keyEncapsulation - A KeyEncapsulation instance holding the matching secret key, ready to decapsulate.
+   */
+
+  /**
+   * Takes a ready keypair from the pool, and starts refilling the pool in the background if it is running low.
+   * If the pool is empty, a keypair is generated on the calling thread instead.
+   * @memberof KeypairPool
+   * @instance
+   * @method
+   * @name take
+   * @returns {KeypairPool.PooledKeypair} - The keypair.
+   * @throws {Error} Will throw an error if the pool has been closed or a keypair cannot be generated.
+   */
+  Napi::Value KeypairPool::take(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Keypair keypair;
+    bool taken = false;
+    {
+      std::lock_guard<std::mutex> lock(reservoir->mutex);
+      if (reservoir->closed) {
+        throw Napi::Error::New(env, "Keypair pool has been closed");
+      }
+      if (!reservoir->keypairs.empty()) {
+        keypair = std::move(reservoir->keypairs.front());
+        reservoir->keypairs.pop_front();
+        taken = true;
+      }
+      schedule(reservoir);
+    }
+    if (!taken) {
+      try {
+        keypair = generateKeypair(*reservoir->kem);
+      } catch (const std::exception& ex) {
+        throw Napi::Error::New(env, ex.what());
+      }
+    }
+    // The secret key moves straight from the reservoir into the instance, so it is never copied into a Buffer.
+    // If constructing the instance throws, the key is still released to the arena, which cleanses it.
+    auto keyEncapsulationObj = AddonData::get(env).keyEncapsulationConstructor.New({
+      Napi::String::New(env, algorithm)
+    });
+    ::KeyEncapsulation::KeyEncapsulation::Unwrap(keyEncapsulationObj)->adoptSecretKey(std::move(keypair.secretKey));
+    auto keypairObj = Napi::Object::New(env);
+    keypairObj.Set(
+      Napi::String::New(env, "publicKey"),
+      Buffers::fromBytes(env, std::move(keypair.publicKey), false)
+    );
+    keypairObj.Set(
+      Napi::String::New(env, "keyEncapsulation"),
+      keyEncapsulationObj
+    );
+    return keypairObj;
+  }
+
+  /**
+   * Gets the number of keypairs that are ready to be taken.
+   * @memberof KeypairPool
+   * @instance
+   * @method
+   * @name getSize
+   * @returns {number} - The number of ready keypairs.
+   */
+  Napi::Value KeypairPool::getSize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::lock_guard<std::mutex> lock(reservoir->mutex);
+    return Napi::Number::New(env, reservoir->keypairs.size());
+  }
+
+  /**
+   * Stops generating keypairs and wipes the secret keys of the keypairs that were never taken.
+   * The pool cannot be used afterwards. This also happens when the pool is garbage collected.
+   * @memberof KeypairPool
+   * @instance
+   * @method
+   * @name close
+   */
+  Napi::Value KeypairPool::close(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    closeReservoir(*reservoir);
+    return env.Undefined();
+  }
+
+  void KeypairPool::Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function func = DefineClass(env, "KeypairPool", {
+      InstanceMethod<&KeypairPool::take>("take"),
+      InstanceMethod<&KeypairPool::getSize>("getSize"),
+      InstanceMethod<&KeypairPool::close>("close")
+    });
+    exports.Set(
+      Napi::String::New(env, "KeypairPool"),
+      func
+    );
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    KeypairPool::Init(env, exports);
+  }
+
+} // namespace KeypairPool
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <napi.h>
+
+namespace KeypairPool {
+
+  struct Reservoir;
+
+  class KeypairPool : public Napi::ObjectWrap<KeypairPool> {
+    private:
+      std::string algorithm;
+      // Shared with the refill tasks, which may outlive the instance
+      std::shared_ptr<Reservoir> reservoir;
+
+    public:
+      explicit KeypairPool(const Napi::CallbackInfo& info);
+      ~KeypairPool();
+      Napi::Value take(const Napi::CallbackInfo& info);
+      Napi::Value getSize(const Napi::CallbackInfo& info);
+      Napi::Value close(const Napi::CallbackInfo& info);
+
+      static void Init(Napi::Env env, Napi::Object exports);
+  };
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
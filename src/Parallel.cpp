@@ -0,0 +1,61 @@
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "ThreadPool.h"
+
+namespace Parallel {
+
+  /**
+   * Shared between the caller and the helper tasks, which may start after the caller has returned.
+   * `fn` is only dereferenced after claiming an index, which cannot happen once every index is done.
+   */
+  struct Loop {
+    std::atomic<std::size_t> nextIndex;
+    std::atomic<std::size_t> completed;
+    std::size_t count;
+    const std::function<void(std::size_t)>* fn;
+    std::mutex mutex;
+    std::condition_variable allDone;
+  };
+
+  static void runUntilDone(Loop& loop) {
+    for (std::size_t i = loop.nextIndex++; i < loop.count; i = loop.nextIndex++) {
+      (*loop.fn)(i);
+      if (++loop.completed == loop.count) {
+        std::lock_guard<std::mutex> lock(loop.mutex);
+        loop.allDone.notify_all();
+      }
+    }
+  }
+
+  void forEach(std::size_t count, const std::function<void(std::size_t)>& fn) {
+    if (count == 0) {
+      return;
+    }
+    auto loop = std::make_shared<Loop>();
+    loop->nextIndex = 0;
+    loop->completed = 0;
+    loop->count = count;
+    loop->fn = &fn;
+    const std::size_t numHelpers = std::min(ThreadPool::concurrency(), count - 1);
+    for (std::size_t i = 0; i < numHelpers; i++) {
+      ThreadPool::submit([loop]() -> void {
+        runUntilDone(*loop);
+      });
+    }
+    // Taking part means the loop finishes even if every worker is busy, including when called from a worker
+    runUntilDone(*loop);
+    std::unique_lock<std::mutex> lock(loop->mutex);
+    loop->allDone.wait(lock, [&loop]() -> bool {
+      return loop->completed == loop->count;
+    });
+  }
+
+} // namespace Parallel
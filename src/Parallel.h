@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Parallel {
+
+  /**
+   * Calls `fn` once for every index in [0, count), spreading the calls over the addon's thread pool.
+   * The calling thread takes part in the work and returns once every call has completed.
+   * `fn` must not throw.
+   */
+  void forEach(std::size_t count, const std::function<void(std::size_t)>& fn);
+
+}
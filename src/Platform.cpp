@@ -0,0 +1,285 @@
+// exports.Platform
+
+#include "Platform.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "Algorithms.h"
+
+/** @namespace Platform */
+namespace Platform {
+
+  struct CpuFeature {
+    OQS_CPU_EXT extension;
+    const char* name;
+  };
+
+  static const CpuFeature CPU_FEATURES[] = {
+    {OQS_CPU_EXT_ADX, "ADX"},
+    {OQS_CPU_EXT_AES, "AES"},
+    {OQS_CPU_EXT_AVX, "AVX"},
+    {OQS_CPU_EXT_AVX2, "AVX2"},
+    {OQS_CPU_EXT_AVX512, "AVX512"},
+    {OQS_CPU_EXT_BMI1, "BMI1"},
+    {OQS_CPU_EXT_BMI2, "BMI2"},
+    {OQS_CPU_EXT_PCLMULQDQ, "PCLMULQDQ"},
+    {OQS_CPU_EXT_VPCLMULQDQ, "VPCLMULQDQ"},
+    {OQS_CPU_EXT_POPCNT, "POPCNT"},
+    {OQS_CPU_EXT_SSE, "SSE"},
+    {OQS_CPU_EXT_SSE2, "SSE2"},
+    {OQS_CPU_EXT_SSE3, "SSE3"},
+    {OQS_CPU_EXT_ARM_AES, "ARM_AES"},
+    {OQS_CPU_EXT_ARM_SHA2, "ARM_SHA2"},
+    {OQS_CPU_EXT_ARM_SHA3, "ARM_SHA3"},
+    {OQS_CPU_EXT_ARM_NEON, "ARM_NEON"}
+  };
+
+  static const char* featureName(OQS_CPU_EXT extension) {
+    for (const auto& feature : CPU_FEATURES) {
+      if (feature.extension == extension) {
+        return feature.name;
+      }
+    }
+    return "";
+  }
+
+  /**
+   * An optimized implementation that was compiled into liboqs, and the CPU features that liboqs requires before dispatching to it.
+   * Applies to every algorithm whose name contains `contains` and does not contain `excludes`.
+   */
+  struct Candidate {
+    const char* contains;
+    const char* excludes;
+    const char* implementation;
+    std::vector<OQS_CPU_EXT> cpuFeatures;
+  };
+
+  /**
+   * Mirrors the dispatch conditions in the liboqs sources.
+   * Only the implementations enabled in oqsconfig.h are listed, keyed by the smallest parameter set of each family.
+   */
+  static const std::vector<Candidate>& candidates() {
+    static const auto* table = new std::vector<Candidate>{
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+      {"Kyber", "-90s", "avx2", {OQS_CPU_EXT_AVX2, OQS_CPU_EXT_BMI2, OQS_CPU_EXT_POPCNT}},
+#endif
+#if defined(OQS_ENABLE_KEM_kyber_512_aarch64)
+      {"Kyber", "-90s", "aarch64", {OQS_CPU_EXT_ARM_NEON}},
+#endif
+#if defined(OQS_ENABLE_KEM_kyber_512_90s_avx2)
+      {"-90s", nullptr, "avx2", {OQS_CPU_EXT_AES, OQS_CPU_EXT_AVX2, OQS_CPU_EXT_BMI2, OQS_CPU_EXT_POPCNT}},
+#endif
+#if defined(OQS_ENABLE_SIG_dilithium_2_avx2)
+      {"Dilithium", "-AES", "avx2", {OQS_CPU_EXT_AVX2, OQS_CPU_EXT_POPCNT}},
+#endif
+#if defined(OQS_ENABLE_SIG_dilithium_2_aarch64)
+      {"Dilithium", "-AES", "aarch64", {OQS_CPU_EXT_ARM_NEON}},
+#endif
+#if defined(OQS_ENABLE_SIG_dilithium_2_aes_avx2)
+      {"-AES", nullptr, "avx2", {OQS_CPU_EXT_AES, OQS_CPU_EXT_AVX2, OQS_CPU_EXT_POPCNT}},
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_512_avx2)
+      {"Falcon", nullptr, "avx2", {OQS_CPU_EXT_AVX2}},
+#endif
+#if defined(OQS_ENABLE_SIG_sphincs_haraka_128f_simple_aesni)
+      {"SPHINCS+-Haraka", nullptr, "aesni", {OQS_CPU_EXT_AES}},
+#endif
+#if defined(OQS_ENABLE_SIG_sphincs_sha256_128f_simple_avx2)
+      {"SPHINCS+-SHA256", nullptr, "avx2", {OQS_CPU_EXT_AVX2}},
+#endif
+#if defined(OQS_ENABLE_SIG_sphincs_shake256_128f_simple_avx2)
+      {"SPHINCS+-SHAKE256", nullptr, "avx2", {OQS_CPU_EXT_AVX2}},
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps2048509_avx2)
+      {"NTRU-H", nullptr, "avx2", {OQS_CPU_EXT_AVX2, OQS_CPU_EXT_BMI2}},
+#endif
+#if defined(OQS_ENABLE_KEM_ntruprime_ntrulpr653_avx2)
+      {"ntrulpr", nullptr, "avx2", {OQS_CPU_EXT_AVX2}},
+#endif
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup653_avx2)
+      {"sntrup", nullptr, "avx2", {OQS_CPU_EXT_AVX2}},
+#endif
+#if defined(OQS_ENABLE_KEM_saber_lightsaber_avx2)
+      {"Saber", nullptr, "avx2", {OQS_CPU_EXT_AVX2}},
+#endif
+#if defined(OQS_ENABLE_KEM_hqc_128_avx2)
+      {"HQC", nullptr, "avx2", {OQS_CPU_EXT_AVX2, OQS_CPU_EXT_BMI1, OQS_CPU_EXT_PCLMULQDQ}},
+#endif
+#if defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx)
+      {"Classic-McEliece", nullptr, "avx", {OQS_CPU_EXT_AVX2, OQS_CPU_EXT_POPCNT}},
+#endif
+    };
+    return *table;
+  }
+
+  /**
+   * Gets the CPU extensions that liboqs detected at runtime, which decide the implementations it dispatches to.
+   * Extensions of other architectures are always false.
+   * @memberof Platform
+   * @name getCpuFeatures
+   * @static
+   * @method
+   * @returns {Object<string, boolean>} - Whether each extension is available, keyed by name, such as `AVX2` or `ARM_NEON`.
+   */
+  Napi::Value getCpuFeatures(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    auto featuresObj = Napi::Object::New(env);
+    for (const auto& feature : CPU_FEATURES) {
+      featuresObj[feature.name] = Napi::Boolean::New(env, OQS_CPU_has_extension(feature.extension) == 1);
+    }
+    return featuresObj;
+  }
+
+  /**
+   * An object with the following properties:
+   * * `algorithm`: The name of the algorithm.
+   * * `implementation`: The implementation that liboqs uses for the algorithm on this CPU, such as `avx2`, or `reference`.
+   * * `candidates`: The optimized implementations compiled into liboqs for the algorithm, each an object with
+   *   `implementation`, `cpuFeatures` (the extensions it requires) and `supported` (whether this CPU has all of them).
+   * @memberof Platform
+   * @typedef {Object} Implementation
+   */
+
+  /**
+   * Gets the implementation of an algorithm that liboqs dispatches to on this CPU.
+   * With the default distributable build, liboqs picks an optimized implementation at runtime if the CPU supports it,
+   * and falls back to reference code otherwise.
+   * @memberof Platform
+   * @name getImplementation
+   * @static
+   * @method
+   * @param {KEMs.Algorithm|Sigs.Algorithm} algorithm - The KEM or signature algorithm to check.
+   * @returns {Platform.Implementation} - The implementation in use and the candidates for it.
+   * @throws {TypeError} Will throw an error if any argument is invalid, or if the algorithm is not enabled.
+   */
+  Napi::Value getImplementation(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    const auto algorithm = info[0].As<Napi::String>().Utf8Value();
+    std::string name;
+    try {
+      if (Algorithms::kems().byName.count(algorithm) > 0) {
+        name = Algorithms::findKEM(algorithm).name;
+      } else {
+        name = Algorithms::findSig(algorithm).name;
+      }
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+    std::string implementation = "reference";
+    bool selected = false;
+    auto candidatesArray = Napi::Array::New(env);
+    std::uint32_t count = 0;
+    for (const auto& candidate : candidates()) {
+      if (
+        name.find(candidate.contains) == std::string::npos ||
+        (candidate.excludes != nullptr && name.find(candidate.excludes) != std::string::npos)
+      ) {
+        continue;
+      }
+      bool supported = true;
+      auto cpuFeaturesArray = Napi::Array::New(env, candidate.cpuFeatures.size());
+      for (std::uint32_t i = 0; i < candidate.cpuFeatures.size(); i++) {
+        cpuFeaturesArray[i] = Napi::String::New(env, featureName(candidate.cpuFeatures[i]));
+        supported = supported && OQS_CPU_has_extension(candidate.cpuFeatures[i]) == 1;
+      }
+      if (supported && !selected) {
+        implementation = candidate.implementation;
+        selected = true;
+      }
+      auto candidateObj = Napi::Object::New(env);
+      candidateObj["implementation"] = Napi::String::New(env, candidate.implementation);
+      candidateObj["cpuFeatures"] = cpuFeaturesArray;
+      candidateObj["supported"] = Napi::Boolean::New(env, supported);
+      candidatesArray[count++] = candidateObj;
+    }
+    auto implementationObj = Napi::Object::New(env);
+    implementationObj["algorithm"] = Napi::String::New(env, name);
+    implementationObj["implementation"] = Napi::String::New(env, implementation);
+    implementationObj["candidates"] = candidatesArray;
+    return implementationObj;
+  }
+
+  /**
+   * Counts the algorithms known to liboqs, whether enabled or not, leaving out the DEFAULT alias.
+   */
+  template <typename Descriptor>
+  static std::size_t supportedCount(const Algorithms::Table<Descriptor>& table) {
+    return table.byName.size() - table.byName.count("DEFAULT");
+  }
+
+  /**
+   * An object with the following properties:
+   * * `liboqsVersion`: The version of liboqs that the addon was built against.
+   * * `distBuild`: Whether liboqs was built to run on any CPU of its architecture, choosing implementations at runtime.
+   * * `hostTuned`: Whether liboqs and the addon were built for the CPU of the build machine (`npm run build:host`).
+   * * `enabledKEMCount`, `supportedKEMCount`: The number of KEMs enabled in this build, and known to this version of liboqs.
+   *   Fewer are enabled when liboqs was built with an algorithm allowlist (`LIBOQS_NODE_ALGORITHMS`).
+   * * `enabledSigCount`, `supportedSigCount`: The same for signature algorithms.
+   * @memberof Platform
+   * @typedef {Object} BuildInfo
+   */
+
+  /**
+   * Gets how liboqs and the addon were built, so that benchmarks of different builds can be told apart.
+   * @memberof Platform
+   * @name getBuildInfo
+   * @static
+   * @method
+   * @returns {Platform.BuildInfo} - The build configuration.
+   */
+  Napi::Value getBuildInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    auto buildInfoObj = Napi::Object::New(env);
+    buildInfoObj["liboqsVersion"] = Napi::String::New(env, OQS_VERSION_TEXT);
+#if defined(OQS_DIST_BUILD)
+    buildInfoObj["distBuild"] = Napi::Boolean::New(env, true);
+#else
+    buildInfoObj["distBuild"] = Napi::Boolean::New(env, false);
+#endif
+#if defined(LIBOQS_NODE_HOST_TUNED)
+    buildInfoObj["hostTuned"] = Napi::Boolean::New(env, true);
+#else
+    buildInfoObj["hostTuned"] = Napi::Boolean::New(env, false);
+#endif
+    buildInfoObj["enabledKEMCount"] = Napi::Number::New(env, Algorithms::kems().enabled.size());
+    buildInfoObj["supportedKEMCount"] = Napi::Number::New(env, supportedCount(Algorithms::kems()));
+    buildInfoObj["enabledSigCount"] = Napi::Number::New(env, Algorithms::sigs().enabled.size());
+    buildInfoObj["supportedSigCount"] = Napi::Number::New(env, supportedCount(Algorithms::sigs()));
+    return buildInfoObj;
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    auto platformExports = Napi::Object::New(env);
+    platformExports.Set(
+      Napi::String::New(env, "getCpuFeatures"),
+      Napi::Function::New(env, getCpuFeatures)
+    );
+    platformExports.Set(
+      Napi::String::New(env, "getImplementation"),
+      Napi::Function::New(env, getImplementation)
+    );
+    platformExports.Set(
+      Napi::String::New(env, "getBuildInfo"),
+      Napi::Function::New(env, getBuildInfo)
+    );
+    exports.Set(
+      Napi::String::New(env, "Platform"),
+      platformExports
+    );
+  }
+
+} // namespace Platform
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <napi.h>
+
+namespace Platform {
+
+  Napi::Value getCpuFeatures(const Napi::CallbackInfo& info);
+  Napi::Value getImplementation(const Napi::CallbackInfo& info);
+  Napi::Value getBuildInfo(const Napi::CallbackInfo& info);
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
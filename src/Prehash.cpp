@@ -0,0 +1,47 @@
+#include "Prehash.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include <oqs/sha3.h>
+
+namespace Prehash {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  Shake256::Shake256() : finalized(false) {
+    OQS_SHA3_shake256_inc_init(&ctx);
+  }
+
+  Shake256::~Shake256() {
+    OQS_SHA3_shake256_inc_ctx_release(&ctx);
+  }
+
+  void Shake256::update(const byte* data, std::size_t length) {
+    if (finalized) {
+      throw std::logic_error("Hash has already been finalized");
+    }
+    OQS_SHA3_shake256_inc_absorb(&ctx, data, length);
+  }
+
+  bytes Shake256::signedMessage() {
+    if (finalized) {
+      throw std::logic_error("Hash has already been finalized");
+    }
+    finalized = true;
+    bytes message(PREFIX, PREFIX + PREFIX_LENGTH);
+    message.resize(SIGNED_MESSAGE_LENGTH);
+    OQS_SHA3_shake256_inc_finalize(&ctx);
+    OQS_SHA3_shake256_inc_squeeze(message.data() + PREFIX_LENGTH, DIGEST_LENGTH, &ctx);
+    return message;
+  }
+
+  bool Shake256::isFinalized() const {
+    return finalized;
+  }
+
+} // namespace Prehash
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include <oqs/sha3.h>
+
+/**
+ * The prehash signing mode used by streaming and file signing.
+ * Instead of the message itself, the signature algorithm signs
+ * `PREFIX || SHAKE256(message, 512 bits)`, where `PREFIX` is the 32-byte ASCII string
+ * `liboqs-node prehash SHAKE256-512`. The prefix gives domain separation by convention only:
+ * anyone can sign `PREFIX || digest` as a plain message, so verifiers must know out of band
+ * which mode a signature was made in.
+ */
+namespace Prehash {
+
+  constexpr char PREFIX[] = "liboqs-node prehash SHAKE256-512";
+  constexpr std::size_t PREFIX_LENGTH = sizeof(PREFIX) - 1;
+  constexpr std::size_t DIGEST_LENGTH = 64;
+  constexpr std::size_t SIGNED_MESSAGE_LENGTH = PREFIX_LENGTH + DIGEST_LENGTH;
+
+  /**
+   * Incrementally hashes a message and produces the message that is signed in prehash mode.
+   */
+  class Shake256 {
+    private:
+      OQS_SHA3_shake256_inc_ctx ctx;
+      bool finalized;
+
+    public:
+      Shake256();
+      Shake256(const Shake256&) = delete;
+      Shake256& operator=(const Shake256&) = delete;
+      ~Shake256();
+
+      /**
+       * Absorbs the next chunk of the message.
+       */
+      void update(const oqs::byte* data, std::size_t length);
+
+      /**
+       * Finishes hashing and returns `PREFIX || digest`. May only be called once.
+       */
+      oqs::bytes signedMessage();
+
+      bool isFinalized() const;
+  };
+
+}
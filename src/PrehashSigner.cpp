@@ -0,0 +1,117 @@
+// exports.PrehashSigner
+
+#include "PrehashSigner.h"
+
+#include <utility>
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "AddonData.h"
+#include "Buffers.h"
+#include "Prehash.h"
+#include "Signature.h"
+
+namespace PrehashSigner {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  /**
+   * Constructs an instance of PrehashSigner, which signs a message that is fed to it in chunks.
+   * Each chunk is hashed as it arrives, so memory use does not depend on the size of the message.
+   * The message is signed in prehash mode: the signature algorithm signs the 32-byte ASCII prefix
+   * `liboqs-node prehash SHAKE256-512` followed by the 64-byte SHAKE256 digest of the message.
+   * Usually created with {@link Signature#createSigner}.
+   * @name PrehashSigner
+   * @class
+   * @constructs PrehashSigner
+   * @param {Signature} signature - The Signature instance whose algorithm and secret key are used to sign.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  PrehashSigner::PrehashSigner(const Napi::CallbackInfo& info) : Napi::ObjectWrap<PrehashSigner>(info), finalized(false) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Signature must be a Signature instance");
+    }
+    if (!info[0].IsObject() || !info[0].As<Napi::Object>().InstanceOf(AddonData::get(env).signatureConstructor.Value())) {
+      throw Napi::TypeError::New(env, "Signature must be a Signature instance");
+    }
+    const auto signatureObj = info[0].As<Napi::Object>();
+    signatureRef = Napi::Persistent(signatureObj);
+    signature = Signature::Signature::Unwrap(signatureObj);
+  }
+
+  /**
+   * Hashes the next chunk of the message.
+   * @memberof PrehashSigner
+   * @instance
+   * @method
+   * @name update
+   * @param {Buffer} chunk - The next chunk of the message.
+   * @returns {PrehashSigner} - The instance, for chaining.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if the signer has already been finalized.
+   */
+  Napi::Value PrehashSigner::update(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Chunk must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Chunk must be a buffer");
+    }
+    if (hash.isFinalized()) {
+      throw Napi::Error::New(env, "Signer has already been finalized");
+    }
+    const auto chunkBuffer = info[0].As<Napi::Buffer<byte>>();
+    hash.update(chunkBuffer.Data(), chunkBuffer.Length());
+    return Value();
+  }
+
+  /**
+   * Finishes hashing the message and signs it. Once this succeeds, the signer cannot be used anymore.
+   * If signing fails, no more chunks can be added, but final can be called again to retry.
+   * @memberof PrehashSigner
+   * @instance
+   * @method
+   * @name final
+   * @returns {Buffer} - The prehash-mode signature for the message.
+   * @throws {Error} Will throw an error if the signer has already been finalized or signing fails.
+   */
+  Napi::Value PrehashSigner::finalize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (finalized) {
+      throw Napi::Error::New(env, "Signer has already been finalized");
+    }
+    if (!hash.isFinalized()) {
+      signedMessage = hash.signedMessage();
+    }
+    bytes signatureBytes;
+    try {
+      signatureBytes = signature->signBytes({signedMessage.data(), signedMessage.size()});
+    } catch (const std::exception& ex) {
+      throw Napi::Error::New(env, ex.what());
+    }
+    finalized = true;
+    return Buffers::fromBytes(env, std::move(signatureBytes), false);
+  }
+
+  void PrehashSigner::Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function func = DefineClass(env, "PrehashSigner", {
+      InstanceMethod<&PrehashSigner::update>("update"),
+      InstanceMethod<&PrehashSigner::finalize>("final")
+    });
+    AddonData::get(env).prehashSignerConstructor = Napi::Persistent(func);
+    exports.Set(
+      Napi::String::New(env, "PrehashSigner"),
+      func
+    );
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    PrehashSigner::Init(env, exports);
+  }
+
+} // namespace PrehashSigner
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "Prehash.h"
+#include "Signature.h"
+
+namespace PrehashSigner {
+
+  class PrehashSigner : public Napi::ObjectWrap<PrehashSigner> {
+    private:
+      // Keeps the Signature alive for as long as the signer is
+      Napi::ObjectReference signatureRef;
+      Signature::Signature* signature;
+      Prehash::Shake256 hash;
+      // The message to sign, kept once the hash is finished so that a failed final() can be retried
+      oqs::bytes signedMessage;
+      bool finalized;
+
+    public:
+      explicit PrehashSigner(const Napi::CallbackInfo& info);
+      Napi::Value update(const Napi::CallbackInfo& info);
+      Napi::Value finalize(const Napi::CallbackInfo& info);
+
+      static void Init(Napi::Env env, Napi::Object exports);
+  };
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
@@ -0,0 +1,124 @@
+// exports.PrehashVerifier
+
+#include "PrehashVerifier.h"
+
+#include <napi.h>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "AddonData.h"
+#include "Prehash.h"
+#include "Signature.h"
+
+namespace PrehashVerifier {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  /**
+   * Constructs an instance of PrehashVerifier, which verifies a prehash-mode signature over a message that is fed to it in chunks.
+   * Each chunk is hashed as it arrives, so memory use does not depend on the size of the message.
+   * See {@link PrehashSigner} for how prehash-mode signatures are made.
+   * Usually created with {@link Signature#createVerifier}.
+   * @name PrehashVerifier
+   * @class
+   * @constructs PrehashVerifier
+   * @param {Signature} signature - The Signature instance whose algorithm is used to verify.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  PrehashVerifier::PrehashVerifier(const Napi::CallbackInfo& info) : Napi::ObjectWrap<PrehashVerifier>(info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Signature must be a Signature instance");
+    }
+    if (!info[0].IsObject() || !info[0].As<Napi::Object>().InstanceOf(AddonData::get(env).signatureConstructor.Value())) {
+      throw Napi::TypeError::New(env, "Signature must be a Signature instance");
+    }
+    const auto signatureObj = info[0].As<Napi::Object>();
+    signatureRef = Napi::Persistent(signatureObj);
+    signature = Signature::Signature::Unwrap(signatureObj);
+  }
+
+  /**
+   * Hashes the next chunk of the message.
+   * @memberof PrehashVerifier
+   * @instance
+   * @method
+   * @name update
+   * @param {Buffer} chunk - The next chunk of the message.
+   * @returns {PrehashVerifier} - The instance, for chaining.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if the verifier has already been finalized.
+   */
+  Napi::Value PrehashVerifier::update(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Chunk must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Chunk must be a buffer");
+    }
+    if (hash.isFinalized()) {
+      throw Napi::Error::New(env, "Verifier has already been finalized");
+    }
+    const auto chunkBuffer = info[0].As<Napi::Buffer<byte>>();
+    hash.update(chunkBuffer.Data(), chunkBuffer.Length());
+    return Value();
+  }
+
+  /**
+   * Finishes hashing the message and verifies the signature. The verifier cannot be used afterwards.
+   * @memberof PrehashVerifier
+   * @instance
+   * @method
+   * @name final
+   * @param {Buffer} signature - The prehash-mode signature to verify.
+   * @param {Buffer} publicKey - The public key to verify the signature against.
+   * @returns {boolean} - Whether the message has a valid signature from the owner of the public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if the verifier has already been finalized.
+   */
+  Napi::Value PrehashVerifier::finalize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+      throw Napi::TypeError::New(env, "Signature and publicKey must be buffers");
+    }
+    if (!info[0].IsBuffer() || !info[1].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Signature and publicKey must be buffers");
+    }
+    if (hash.isFinalized()) {
+      throw Napi::Error::New(env, "Verifier has already been finalized");
+    }
+    const auto signatureBuffer = info[0].As<Napi::Buffer<byte>>();
+    const auto publicKeyBuffer = info[1].As<Napi::Buffer<byte>>();
+    const bytes signedMessage = hash.signedMessage();
+    try {
+      bool valid = signature->verifyBytes(
+        {signedMessage.data(), signedMessage.size()},
+        {signatureBuffer.Data(), signatureBuffer.Length()},
+        {publicKeyBuffer.Data(), publicKeyBuffer.Length()}
+      );
+      return Napi::Boolean::New(env, valid);
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+  }
+
+  void PrehashVerifier::Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function func = DefineClass(env, "PrehashVerifier", {
+      InstanceMethod<&PrehashVerifier::update>("update"),
+      InstanceMethod<&PrehashVerifier::finalize>("final")
+    });
+    AddonData::get(env).prehashVerifierConstructor = Napi::Persistent(func);
+    exports.Set(
+      Napi::String::New(env, "PrehashVerifier"),
+      func
+    );
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    PrehashVerifier::Init(env, exports);
+  }
+
+} // namespace PrehashVerifier
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <napi.h>
+
+#include "Prehash.h"
+#include "Signature.h"
+
+namespace PrehashVerifier {
+
+  class PrehashVerifier : public Napi::ObjectWrap<PrehashVerifier> {
+    private:
+      // Keeps the Signature alive for as long as the verifier is
+      Napi::ObjectReference signatureRef;
+      Signature::Signature* signature;
+      Prehash::Shake256 hash;
+
+    public:
+      explicit PrehashVerifier(const Napi::CallbackInfo& info);
+      Napi::Value update(const Napi::CallbackInfo& info);
+      Napi::Value finalize(const Napi::CallbackInfo& info);
+
+      static void Init(Napi::Env env, Napi::Object exports);
+  };
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
@@ -2,8 +2,15 @@
 
 #include "Random.h"
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
-#include <new>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <strings.h>
+#include <utility>
 #include <vector>
 #include <napi.h>
 
@@ -11,17 +18,49 @@
 #include "rand/rand.h"
 #include "common.h"
 
+#include "AsyncJob.h"
+#include "Buffers.h"
+#include "Drbg.h"
+#include "SecureArena.h"
+
 /** @namespace Random */
 namespace Random {
 
   using oqs::byte;
   using oqs::bytes;
 
+  struct State {
+    // Held exclusively while the selection or the NIST-KAT seed changes, and shared while random bytes are drawn
+    std::shared_mutex mutex;
+    // Whether the selected algorithm needs draws to be serialized
+    std::atomic<bool> serialized{false};
+  };
+
+  /**
+   * The RNG state, shared by every environment and thread, since liboqs only has one RNG selection per process.
+   * Intentionally never freed, since worker threads may still draw random bytes during exit.
+   */
+  static State& state() {
+    static State* instance = new State();
+    return *instance;
+  }
+
+  Guard::Guard() : sharedLock(state().mutex) {
+    // The flag only changes under the exclusive lock, so it cannot change while the shared lock is held
+    if (state().serialized.load(std::memory_order_relaxed)) {
+      sharedLock.unlock();
+      exclusiveLock = std::unique_lock<std::shared_mutex>(state().mutex);
+    }
+  }
+
   /**
    * The different PRNG algorithms that can be used. It can be one of the following:
    * * `system`: System PRNG. Reads directly from `/dev/urandom`.
    * * `NIST-KAT`: NIST deterministic RNG for KATs.
    * * `OpenSSL`: OpenSSL's PRNG.
+   * * `SHAKE256-DRBG`: A buffered SHAKE256-based DRBG per thread, seeded from OpenSSL's PRNG.
+   *   Hands out random bytes from 16 KiB chunks, so most operations make no system call.
+   *   Reseeds after every MiB of output and in the child after `fork()`.
    * Defaults to `system`.
    * @memberof Random
    * @typedef {string} Algorithm
@@ -29,6 +68,8 @@ namespace Random {
 
   /**
    * Switches the PRNG algorithm used by the library.
+   * The selection is shared by every thread of the process, including worker threads.
+   * Operations already drawing random bytes finish with the previous algorithm before the switch takes effect.
    * @memberof Random
    * @name switchAlgorithm
    * @static
@@ -45,11 +86,19 @@ namespace Random {
       throw Napi::TypeError::New(env, "Algorithm must be a string");
     }
     const auto algorithm = info[0].As<Napi::String>().Utf8Value();
+    std::unique_lock<std::shared_mutex> lock(state().mutex);
+    if (strcasecmp(algorithm.c_str(), Drbg::ALGORITHM) == 0) {
+      Drbg::install();
+      state().serialized.store(false, std::memory_order_relaxed);
+      return env.Undefined();
+    }
     try {
       oqs::rand::randombytes_switch_algorithm(algorithm);
     } catch (const std::exception& ex) {
       throw Napi::TypeError::New(env, ex.what());
     }
+    // liboqs matches algorithm names case-insensitively
+    state().serialized.store(strcasecmp(algorithm.c_str(), "NIST-KAT") == 0, std::memory_order_relaxed);
     return env.Undefined();
   }
 
@@ -79,24 +128,151 @@ namespace Random {
     if (static_cast<std::uint64_t>(size) > SIZE_MAX) {
       throw Napi::TypeError::New(env, "Bytes exceeds the maximum number of bytes that can be generated");
     }
-    bytes* randBytes = new (std::nothrow) bytes(size);
-    if (randBytes == nullptr) {
-      throw Napi::Error::New(env, "Failed to allocate memory");
+    SecureArena::Block randBytes = Buffers::allocateSecret(env, static_cast<std::size_t>(size));
+    {
+      Guard guard;
+      OQS_randombytes(randBytes.data(), randBytes.size());
+    }
+    return Buffers::fromBlock(env, std::move(randBytes));
+  }
+
+  // Fills up to this size are done on the calling thread even by randomFillAsync, since a thread hop would cost more
+  static constexpr std::size_t ASYNC_THRESHOLD = 4096;
+
+  /**
+   * The region of caller-owned memory to fill with random bytes.
+   */
+  struct FillTarget {
+    byte* data;
+    std::size_t size;
+  };
+
+  /**
+   * Gets the memory behind a Buffer, TypedArray, DataView or ArrayBuffer.
+   * TypedArrays and DataViews may be backed by a SharedArrayBuffer.
+   * Returns false if the value is none of these.
+   */
+  static bool getMemory(Napi::Env env, Napi::Value value, FillTarget& memory) {
+    void* data = nullptr;
+    std::size_t size = 0;
+    if (value.IsTypedArray()) {
+      napi_typedarray_type type;
+      std::size_t length = 0;
+      if (napi_get_typedarray_info(env, value, &type, &length, &data, nullptr, nullptr) != napi_ok) {
+        return false;
+      }
+      size = value.As<Napi::TypedArray>().ByteLength();
+    } else if (value.IsDataView()) {
+      if (napi_get_dataview_info(env, value, &size, &data, nullptr, nullptr) != napi_ok) {
+        return false;
+      }
+    } else if (value.IsArrayBuffer()) {
+      auto arrayBuffer = value.As<Napi::ArrayBuffer>();
+      data = arrayBuffer.Data();
+      size = arrayBuffer.ByteLength();
+    } else {
+      return false;
+    }
+    memory = {static_cast<byte*>(data), size};
+    return true;
+  }
+
+  /**
+   * Reads the arguments of randomFill and randomFillAsync, returning the region to fill.
+   */
+  static FillTarget parseFillArguments(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    FillTarget memory{nullptr, 0};
+    if (info.Length() < 1 || !getMemory(env, info[0], memory)) {
+      throw Napi::TypeError::New(env, "Buffer must be a Buffer, TypedArray, DataView or ArrayBuffer");
     }
-    oqs::rand::randombytes(*randBytes, static_cast<std::size_t>(size));
-    Napi::MemoryManagement::AdjustExternalMemory(env, size);
-    return Napi::Buffer<byte>::New(
+    std::size_t offset = 0;
+    if (info.Length() >= 2 && !info[1].IsUndefined()) {
+      if (!info[1].IsNumber()) {
+        throw Napi::TypeError::New(env, "Offset must be a number");
+      }
+      const double value = info[1].As<Napi::Number>().DoubleValue();
+      if (!(value >= 0 && value <= memory.size) || value != static_cast<double>(static_cast<std::int64_t>(value))) {
+        throw Napi::TypeError::New(env, "Offset must be an integer within the buffer");
+      }
+      offset = static_cast<std::size_t>(value);
+    }
+    std::size_t size = memory.size - offset;
+    if (info.Length() >= 3 && !info[2].IsUndefined()) {
+      if (!info[2].IsNumber()) {
+        throw Napi::TypeError::New(env, "Size must be a number");
+      }
+      const double value = info[2].As<Napi::Number>().DoubleValue();
+      if (!(value >= 0 && value <= memory.size - offset) || value != static_cast<double>(static_cast<std::int64_t>(value))) {
+        throw Napi::TypeError::New(env, "Size must be an integer that fits in the buffer after the offset");
+      }
+      size = static_cast<std::size_t>(value);
+    }
+    return {memory.data + offset, size};
+  }
+
+  /**
+   * Fills part of an existing buffer with cryptographically-secure random bytes, without allocating.
+   * Offsets and sizes are in bytes, whatever the type of the buffer.
+   * @memberof Random
+   * @name randomFill
+   * @static
+   * @method
+   * @param {Buffer|TypedArray|DataView|ArrayBuffer} buffer - The buffer to fill. TypedArrays and DataViews over a SharedArrayBuffer are supported.
+   * @param {number} [offset] - The byte offset to start filling at. Defaults to `0`.
+   * @param {number} [size] - The number of bytes to fill. Defaults to the rest of the buffer after `offset`.
+   * @returns {Buffer|TypedArray|DataView|ArrayBuffer} - The buffer that was passed in.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value randomFill(const Napi::CallbackInfo& info) {
+    const FillTarget target = parseFillArguments(info);
+    {
+      Guard guard;
+      OQS_randombytes(target.data, target.size);
+    }
+    return info[0];
+  }
+
+  /**
+   * Asynchronously fills part of an existing buffer with cryptographically-secure random bytes, without allocating.
+   * Fills larger than 4 KiB are done on a worker thread; the buffer must not be used until the returned Promise settles.
+   * Offsets and sizes are in bytes, whatever the type of the buffer.
+   * @memberof Random
+   * @name randomFillAsync
+   * @static
+   * @method
+   * @async
+   * @param {Buffer|TypedArray|DataView|ArrayBuffer} buffer - The buffer to fill. TypedArrays and DataViews over a SharedArrayBuffer are supported.
+   * @param {number} [offset] - The byte offset to start filling at. Defaults to `0`.
+   * @param {number} [size] - The number of bytes to fill. Defaults to the rest of the buffer after `offset`.
+   * @returns {Promise<Buffer|TypedArray|DataView|ArrayBuffer>} - A Promise that resolves to the buffer that was passed in.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value randomFillAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    const FillTarget target = parseFillArguments(info);
+    if (target.size <= ASYNC_THRESHOLD) {
+      {
+        Guard guard;
+        OQS_randombytes(target.data, target.size);
+      }
+      auto deferred = Napi::Promise::Deferred::New(env);
+      deferred.Resolve(info[0]);
+      return deferred.Promise();
+    }
+    // Keeps the buffer alive until the job settles; released on the main thread along with the job
+    auto bufferRef = std::make_shared<Napi::ObjectReference>(Napi::Persistent(info[0].As<Napi::Object>()));
+    return AsyncJob::run<bool>(
       env,
-      randBytes->data(),
-      size,
-      [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-        if (vec != nullptr) {
-          Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-          oqs::mem_cleanse(*vec);
-        }
-        delete vec;
+      {},
+      [target]() -> bool {
+        Guard guard;
+        OQS_randombytes(target.data, target.size);
+        return true;
       },
-      randBytes
+      [bufferRef](Napi::Env, bool&) -> Napi::Value {
+        return bufferRef->Value();
+      }
     );
   }
 
@@ -122,6 +298,7 @@ namespace Random {
     const auto entropyBuffer = info[0].As<Napi::Buffer<byte>>();
     const auto entropyData = entropyBuffer.Data();
     bytes entropyVec(entropyData, entropyData + entropyBuffer.Length());
+    std::unique_lock<std::shared_mutex> lock(state().mutex);
     if (info.Length() >= 2) {
       if (!info[1].IsBuffer()) {
         throw Napi::TypeError::New(env, "Personalization string must be a Buffer");
@@ -159,6 +336,14 @@ namespace Random {
       Napi::String::New(env, "randomBytes"),
       Napi::Function::New(env, randomBytes)
     );
+    randExports.Set(
+      Napi::String::New(env, "randomFill"),
+      Napi::Function::New(env, randomFill)
+    );
+    randExports.Set(
+      Napi::String::New(env, "randomFillAsync"),
+      Napi::Function::New(env, randomFillAsync)
+    );
     randExports.Set(
       Napi::String::New(env, "initNistKat"),
       Napi::Function::New(env, initNistKat)
@@ -1,11 +1,31 @@
 #pragma once
 
+#include <mutex>
+#include <shared_mutex>
 #include <napi.h>
 
 namespace Random {
 
+  /**
+   * Keeps the process-wide liboqs RNG selection from changing while random bytes are drawn from it.
+   * Hold one around every liboqs call that may draw random bytes (keypair generation, encapsulation, signing).
+   * Calls run concurrently, except while the NIST-KAT DRBG is selected: its state is not thread-safe, so they run one at a time.
+   */
+  class Guard {
+    private:
+      std::shared_lock<std::shared_mutex> sharedLock;
+      std::unique_lock<std::shared_mutex> exclusiveLock;
+
+    public:
+      Guard();
+      Guard(const Guard&) = delete;
+      Guard& operator=(const Guard&) = delete;
+  };
+
   Napi::Value switchAlgorithm(const Napi::CallbackInfo& info);
   Napi::Value randomBytes(const Napi::CallbackInfo& info);
+  Napi::Value randomFill(const Napi::CallbackInfo& info);
+  Napi::Value randomFillAsync(const Napi::CallbackInfo& info);
   Napi::Value initNistKat(const Napi::CallbackInfo& info);
 
   void Init(Napi::Env env, Napi::Object exports);
@@ -0,0 +1,21 @@
+#include "SecureArena.h"
+
+#include "SlotAllocator.h"
+
+namespace SecureArena {
+
+  /**
+   * Intentionally never freed, since Buffers may release slots during exit.
+   * The slot sizes cover the shared secrets and seeds of every algorithm, and the secret keys of most.
+   */
+  SlotAllocator& allocator() {
+    static auto* instance = new SlotAllocator({
+      {64, 256, 1024, 4096, 16384},
+      64 * 1024,
+      16,
+      true
+    });
+    return *instance;
+  }
+
+} // namespace SecureArena
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "SlotAllocator.h"
+
+/**
+ * An allocator for secrets (secret keys, shared secrets and random bytes).
+ * Memory comes from fixed-size slots carved out of a few regions that are locked into RAM
+ * and excluded from core dumps where the platform allows it, and is cleansed when released.
+ * Slots are recycled, so handing out a secret does not need a heap allocation.
+ * Secrets too large for the biggest slot get a mapping of their own with the same protections where possible.
+ * Secrets allocated once the arena is full, or whose own mapping fails, fall back to the heap.
+ * Safe to use from any thread.
+ */
+namespace SecureArena {
+
+  /**
+   * The arena, shared by every thread of the process.
+   */
+  SlotAllocator& allocator();
+
+  /**
+   * Allocates `size` bytes. Throws std::bad_alloc if no memory is available.
+   */
+  inline oqs::byte* allocate(std::size_t size) {
+    return allocator().allocate(size);
+  }
+
+  /**
+   * Cleanses and releases memory returned by allocate(). `size` must be the size it was allocated with.
+   */
+  inline void release(oqs::byte* data, std::size_t size) noexcept {
+    allocator().release(data, size);
+  }
+
+  /**
+   * Owns memory from the arena until it is released or handed over, for example to a Buffer.
+   */
+  class Block : public SlotAllocator::Block {
+    public:
+      Block() = default;
+
+      explicit Block(std::size_t size) : SlotAllocator::Block(SecureArena::allocator(), size) {}
+  };
+
+}
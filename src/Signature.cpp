@@ -2,9 +2,14 @@
 
 #include "Signature.h"
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <string>
+#include <utility>
 #include <vector>
 #include <napi.h>
 
@@ -12,6 +17,16 @@
 #include "oqs_cpp.h"
 #include "common.h"
 
+#include "AddonData.h"
+#include "Algorithms.h"
+#include "AsyncJob.h"
+#include "Buffers.h"
+#include "FileReader.h"
+#include "KeypairBatch.h"
+#include "Parallel.h"
+#include "Prehash.h"
+#include "Slab.h"
+
 namespace Signature {
 
   using oqs::byte;
@@ -24,6 +39,8 @@ namespace Signature {
    * @constructs Signature
    * @param {Sigs.Algorithm} algorithm - The signature algorithm to use.
    * @param {Buffer} [secretKey] - An optional secret key. If not specified, use Signature#generateKeypair later to create a secret key.
+   *   The instance keeps its own copy of the secret key in memory that is locked into RAM where possible,
+   *   and cleanses it when the key is replaced or the instance is garbage collected.
    * @throws {TypeError} Will throw an error if any argument is invalid.
    */
   Signature::Signature(const Napi::CallbackInfo& info) : Napi::ObjectWrap<Signature>(info) {
@@ -40,16 +57,17 @@ namespace Signature {
         throw Napi::TypeError::New(env, "Secret key must be a buffer");
       }
       const auto secretKeyBuffer = info[1].As<Napi::Buffer<byte>>();
-      const auto secretKeyData = secretKeyBuffer.Data();
-      const bytes secretKeyVec(secretKeyData, secretKeyData + secretKeyBuffer.Length());
       try {
-        oqsSig = std::make_unique<oqs::Signature>(algorithm, secretKeyVec);
+        oqsSig = std::make_unique<oqs_span::Signature>(
+          algorithm,
+          oqs_span::byte_span{secretKeyBuffer.Data(), secretKeyBuffer.Length()}
+        );
       } catch (const std::exception& ex) {
         throw Napi::TypeError::New(env, ex.what());
       }
     } else {
       try {
-        oqsSig = std::make_unique<oqs::Signature>(algorithm);
+        oqsSig = std::make_unique<oqs_span::Signature>(algorithm);
       } catch (const std::exception& ex) {
         throw Napi::TypeError::New(env, ex.what());
       }
@@ -58,6 +76,7 @@ namespace Signature {
 
   /**
    * Gets the details for the signature algorithm that the instance was constructed with.
+   * The object is frozen and shared with Sigs.getDetails.
    * @memberof Signature
    * @instance
    * @method
@@ -66,37 +85,7 @@ namespace Signature {
    */
   Napi::Value Signature::getDetails(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    const oqs::Signature::SignatureDetails details = oqsSig->get_details();
-    auto detailsObj = Napi::Object::New(env);
-    detailsObj.Set(
-      Napi::String::New(env, "name"),
-      Napi::String::New(env, details.name)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "version"),
-      Napi::String::New(env, details.version)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "claimedNistLevel"),
-      Napi::Number::New(env, details.claimed_nist_level)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "isEUFCMA"),
-      Napi::Boolean::New(env, details.is_euf_cma)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "publicKeyLength"),
-      Napi::Number::New(env, details.length_public_key)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "secretKeyLength"),
-      Napi::Number::New(env, details.length_secret_key)
-    );
-    detailsObj.Set(
-      Napi::String::New(env, "maxSignatureLength"),
-      Napi::Number::New(env, details.max_length_signature)
-    );
-    return detailsObj;
+    return Algorithms::sigDetails(env, oqsSig->get_details().name);
   }
 
   /**
@@ -111,25 +100,12 @@ namespace Signature {
   Napi::Value Signature::generateKeypair(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     try {
-      const bytes publicKeyVec = oqsSig->generate_keypair();
-      bytes* publicKeyVecCopy = new bytes(publicKeyVec);
-      if (publicKeyVecCopy == nullptr) {
-        throw Napi::Error::New(env, "Failed to allocate memory");
-      }
-      Napi::MemoryManagement::AdjustExternalMemory(env, publicKeyVecCopy->size());
-      return Napi::Buffer<byte>::New(
-        env,
-        publicKeyVecCopy->data(),
-        publicKeyVecCopy->size(),
-        [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-          if (vec != nullptr) {
-            Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-            // No need to secure free public key
-          }
-          delete vec;
-        },
-        publicKeyVecCopy
-      );
+      const std::size_t publicKeyLength = oqsSig->get_details().length_public_key;
+      Slab::Block publicKey = Buffers::allocatePublic(env, publicKeyLength);
+      std::unique_lock<std::mutex> lock(mutex);
+      oqsSig->generate_keypair(publicKey.data());
+      lock.unlock();
+      return Buffers::fromBlock(env, std::move(publicKey), publicKeyLength);
     } catch (const std::exception& ex) {
       throw Napi::Error::New(env, ex.what());
     }
@@ -146,26 +122,9 @@ namespace Signature {
    */
   Napi::Value Signature::exportSecretKey(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    bytes secretKeyVec = oqsSig->export_secret_key();
-    bytes* secretKeyVecCopy = new (std::nothrow) bytes(secretKeyVec);
-    oqs::mem_cleanse(secretKeyVec);
-    if (secretKeyVecCopy == nullptr) {
-      throw Napi::Error::New(env, "Failed to allocate memory");
-    }
-    Napi::MemoryManagement::AdjustExternalMemory(env, secretKeyVecCopy->size());
-    return Napi::Buffer<byte>::New(
-      env,
-      secretKeyVecCopy->data(),
-      secretKeyVecCopy->size(),
-      [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-        if (vec != nullptr) {
-          Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-          oqs::mem_cleanse(*vec);
-        }
-        delete vec;
-      },
-      secretKeyVecCopy
-    );
+    std::lock_guard<std::mutex> lock(mutex);
+    const oqs_span::byte_span secretKey = oqsSig->secret_key();
+    return Buffers::copySecret(env, secretKey.data, secretKey.size);
   }
 
   /**
@@ -188,28 +147,12 @@ namespace Signature {
       throw Napi::TypeError::New(env, "Message must be a buffer");
     }
     const auto messageBuffer = info[0].As<Napi::Buffer<byte>>();
-    const auto messageData = messageBuffer.Data();
-    const bytes messageVec(messageData, messageData + messageBuffer.Length());
+    Slab::Block signature = Buffers::allocatePublic(env, oqsSig->get_details().max_length_signature);
     try {
-      bytes signatureVec = oqsSig->sign(messageVec);
-      bytes* signatureVecCopy = new (std::nothrow) bytes(signatureVec);
-      if (signatureVecCopy == nullptr) {
-        throw Napi::Error::New(env, "Failed to allocate memory");
-      }
-      Napi::MemoryManagement::AdjustExternalMemory(env, signatureVecCopy->size());
-      return Napi::Buffer<byte>::New(
-        env,
-        signatureVecCopy->data(),
-        signatureVecCopy->size(),
-        [](Napi::Env cbEnv, byte* /* unused */, bytes* vec) -> void {
-          if (vec != nullptr) {
-            Napi::MemoryManagement::AdjustExternalMemory(cbEnv, -vec->size());
-            // No need to secure free signature
-          }
-          delete vec;
-        },
-        signatureVecCopy
-      );
+      std::unique_lock<std::mutex> lock(mutex);
+      const std::size_t signatureLength = oqsSig->sign({messageBuffer.Data(), messageBuffer.Length()}, signature.data());
+      lock.unlock();
+      return Buffers::fromBlock(env, std::move(signature), signatureLength);
     } catch (const std::exception& ex) {
       throw Napi::TypeError::New(env, ex.what());
     }
@@ -237,40 +180,637 @@ namespace Signature {
     }
 
     const auto messageBuffer = info[0].As<Napi::Buffer<byte>>();
-    const auto messageData = messageBuffer.Data();
-    const bytes messageVec(messageData, messageData + messageBuffer.Length());
+    const oqs_span::byte_span message{messageBuffer.Data(), messageBuffer.Length()};
 
     const auto signatureBuffer = info[1].As<Napi::Buffer<byte>>();
-    const auto signatureData = signatureBuffer.Data();
-    const bytes signatureVec(signatureData, signatureData + signatureBuffer.Length());
+    const oqs_span::byte_span signature{signatureBuffer.Data(), signatureBuffer.Length()};
 
     const auto publicKeyBuffer = info[2].As<Napi::Buffer<byte>>();
-    const auto publicKeyData = publicKeyBuffer.Data();
-    const bytes publicKeyVec(publicKeyData, publicKeyData + publicKeyBuffer.Length());
+    const oqs_span::byte_span publicKey{publicKeyBuffer.Data(), publicKeyBuffer.Length()};
 
     try {
-      bool valid = oqsSig->verify(messageVec, signatureVec, publicKeyVec);
+      bool valid = oqsSig->verify(message, signature, publicKey);
       return Napi::Boolean::New(env, valid);
     } catch (const std::exception& ex) {
       throw Napi::TypeError::New(env, ex.what());
     }
   }
 
+  /**
+   * Asynchronously generates a keypair on a worker thread.
+   * Overwrites any existing secret key on the instance with the generated secret key.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name generateKeypairAsync
+   * @returns {Promise<Buffer>} - A Promise that resolves to a Buffer containing the public key.
+   */
+  Napi::Value Signature::generateKeypairAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return AsyncJob::run<Slab::Block>(
+      env,
+      {Value()},
+      [this]() -> Slab::Block {
+        Slab::Block publicKey(oqsSig->get_details().length_public_key);
+        std::lock_guard<std::mutex> lock(mutex);
+        oqsSig->generate_keypair(publicKey.data());
+        return publicKey;
+      },
+      [](Napi::Env cbEnv, Slab::Block& publicKey) -> Napi::Value {
+        const std::size_t length = publicKey.size();
+        return Buffers::fromBlock(cbEnv, std::move(publicKey), length);
+      }
+    );
+  }
+
+  /**
+   * Asynchronously signs a message on a worker thread.
+   * The Buffer must not be modified until the returned Promise settles.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name signAsync
+   * @param {Buffer} message - The message to sign.
+   * @returns {Promise<Buffer>} - A Promise that resolves to the signature for the message.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::signAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Message must be a buffer");
+    }
+    if (!info[0].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Message must be a buffer");
+    }
+    const auto messageBuffer = info[0].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span message{messageBuffer.Data(), messageBuffer.Length()};
+    // The slot holding the signature, and the length of the signature within it
+    using SignResult = std::pair<Slab::Block, std::size_t>;
+    return AsyncJob::run<SignResult>(
+      env,
+      {Value(), messageBuffer},
+      [this, message]() -> SignResult {
+        SignResult signResult(Slab::Block(oqsSig->get_details().max_length_signature), 0);
+        std::lock_guard<std::mutex> lock(mutex);
+        signResult.second = oqsSig->sign(message, signResult.first.data());
+        return signResult;
+      },
+      [](Napi::Env cbEnv, SignResult& signResult) -> Napi::Value {
+        return Buffers::fromBlock(cbEnv, std::move(signResult.first), signResult.second);
+      }
+    );
+  }
+
+  /**
+   * Asynchronously verifies the signature belonging to a message on a worker thread.
+   * The Buffers must not be modified until the returned Promise settles.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name verifyAsync
+   * @param {Buffer} message - The message that was signed to produce the signature.
+   * @param {Buffer} signature - The signature to verify.
+   * @param {Buffer} publicKey - The public key to verify the signature against.
+   * @returns {Promise<boolean>} - A Promise that resolves to whether the message has a valid signature from the owner of the public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::verifyAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+      throw Napi::TypeError::New(env, "Message, signature, and publicKey must be buffers");
+    }
+    if (!info[0].IsBuffer() || !info[1].IsBuffer() || !info[2].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Message, signature, and publicKey must be buffers");
+    }
+
+    const auto messageBuffer = info[0].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span message{messageBuffer.Data(), messageBuffer.Length()};
+
+    const auto signatureBuffer = info[1].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span signature{signatureBuffer.Data(), signatureBuffer.Length()};
+
+    const auto publicKeyBuffer = info[2].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span publicKey{publicKeyBuffer.Data(), publicKeyBuffer.Length()};
+
+    return AsyncJob::run<bool>(
+      env,
+      {Value(), messageBuffer, signatureBuffer, publicKeyBuffer},
+      [this, message, signature, publicKey]() -> bool {
+        return oqsSig->verify(message, signature, publicKey);
+      },
+      [](Napi::Env cbEnv, bool& valid) -> Napi::Value {
+        return Napi::Boolean::New(cbEnv, valid);
+      }
+    );
+  }
+
+  /**
+   * A message, signature, and public key that are verified together as part of a batch.
+   * The spans refer to the memory of Buffers owned by the caller.
+   */
+  struct BatchItem {
+    oqs_span::byte_span message;
+    oqs_span::byte_span signature;
+    oqs_span::byte_span publicKey;
+  };
+
+  /**
+   * Reads the messages, signatures, and public keys passed to a batch verification method.
+   * Every Buffer that the returned items point into is appended to `buffers`.
+   */
+  static std::vector<BatchItem> parseBatch(const Napi::CallbackInfo& info, std::vector<Napi::Object>& buffers) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+      throw Napi::TypeError::New(env, "Messages and signatures must be arrays of buffers");
+    }
+    if (!info[0].IsArray() || !info[1].IsArray()) {
+      throw Napi::TypeError::New(env, "Messages and signatures must be arrays of buffers");
+    }
+    if (!info[2].IsArray() && !info[2].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Public keys must be a buffer or an array of buffers");
+    }
+    const auto messages = info[0].As<Napi::Array>();
+    const auto signatures = info[1].As<Napi::Array>();
+    const bool sharedPublicKey = info[2].IsBuffer();
+    if (messages.Length() != signatures.Length()) {
+      throw Napi::TypeError::New(env, "Messages and signatures must have the same length");
+    }
+    if (!sharedPublicKey && info[2].As<Napi::Array>().Length() != messages.Length()) {
+      throw Napi::TypeError::New(env, "Messages and public keys must have the same length");
+    }
+    std::vector<BatchItem> items(messages.Length());
+    buffers.reserve(buffers.size() + 3 * items.size());
+    for (std::uint32_t i = 0; i < messages.Length(); i++) {
+      const Napi::Value messageValue = messages.Get(i);
+      const Napi::Value signatureValue = signatures.Get(i);
+      const Napi::Value publicKeyValue = sharedPublicKey ? info[2] : info[2].As<Napi::Array>().Get(i);
+      if (!messageValue.IsBuffer() || !signatureValue.IsBuffer() || !publicKeyValue.IsBuffer()) {
+        throw Napi::TypeError::New(env, "Messages, signatures, and public keys must be buffers");
+      }
+      const auto messageBuffer = messageValue.As<Napi::Buffer<byte>>();
+      const auto signatureBuffer = signatureValue.As<Napi::Buffer<byte>>();
+      const auto publicKeyBuffer = publicKeyValue.As<Napi::Buffer<byte>>();
+      items[i] = {
+        {messageBuffer.Data(), messageBuffer.Length()},
+        {signatureBuffer.Data(), signatureBuffer.Length()},
+        {publicKeyBuffer.Data(), publicKeyBuffer.Length()}
+      };
+      buffers.push_back(messageBuffer);
+      buffers.push_back(signatureBuffer);
+      if (!sharedPublicKey) {
+        buffers.push_back(publicKeyBuffer);
+      }
+    }
+    if (sharedPublicKey) {
+      buffers.push_back(info[2].As<Napi::Object>());
+    }
+    return items;
+  }
+
+  /**
+   * Verifies a single batch item. Malformed items are reported as invalid rather than throwing.
+   */
+  static bool verifyBatchItem(const oqs_span::Signature& oqsSig, const BatchItem& item) {
+    try {
+      return oqsSig.verify(item.message, item.signature, item.publicKey);
+    } catch (const std::exception& /* unused */) {
+      return false;
+    }
+  }
+
+  /**
+   * Verifies every batch item in parallel.
+   */
+  static std::vector<bool> verifyBatchItems(const oqs_span::Signature& oqsSig, const std::vector<BatchItem>& items) {
+    // std::vector<bool> packs bits, so it cannot be written from several threads at once
+    std::vector<std::uint8_t> results(items.size());
+    Parallel::forEach(items.size(), [&](std::size_t i) -> void {
+      results[i] = verifyBatchItem(oqsSig, items[i]);
+    });
+    return std::vector<bool>(results.begin(), results.end());
+  }
+
+  /**
+   * Verifies batch items in parallel, stopping early once an invalid item is found.
+   */
+  static bool verifyAllBatchItems(const oqs_span::Signature& oqsSig, const std::vector<BatchItem>& items) {
+    std::atomic<bool> allValid(true);
+    Parallel::forEach(items.size(), [&](std::size_t i) -> void {
+      if (!allValid.load(std::memory_order_relaxed)) {
+        return;
+      }
+      if (!verifyBatchItem(oqsSig, items[i])) {
+        allValid.store(false, std::memory_order_relaxed);
+      }
+    });
+    return allValid.load();
+  }
+
+  /**
+   * Converts per-item batch results into an array of booleans.
+   */
+  static Napi::Value batchResultsToArray(Napi::Env env, const std::vector<bool>& results) {
+    auto resultsArray = Napi::Array::New(env, results.size());
+    for (std::uint32_t i = 0; i < results.size(); i++) {
+      resultsArray[i] = Napi::Boolean::New(env, results[i]);
+    }
+    return resultsArray;
+  }
+
+  /**
+   * Verifies a batch of signatures in one call, spreading the work over the threads of the {@link ThreadPool}.
+   * An item with a malformed signature or public key is reported as invalid.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @name verifyBatch
+   * @param {Buffer[]} messages - The messages that were signed.
+   * @param {Buffer[]} signatures - The signatures to verify, in the same order as `messages`.
+   * @param {(Buffer[]|Buffer)} publicKeys - The public keys to verify the signatures against, in the same order as `messages`, or a single public key to use for every message.
+   * @returns {boolean[]} - Whether each message has a valid signature from the owner of the corresponding public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::verifyBatch(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<Napi::Object> buffers;
+    const std::vector<BatchItem> items = parseBatch(info, buffers);
+    return batchResultsToArray(env, verifyBatchItems(*oqsSig, items));
+  }
+
+  /**
+   * Asynchronously verifies a batch of signatures, spreading the work over the threads of the {@link ThreadPool}.
+   * The Buffers must not be modified until the returned Promise settles.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name verifyBatchAsync
+   * @param {Buffer[]} messages - The messages that were signed.
+   * @param {Buffer[]} signatures - The signatures to verify, in the same order as `messages`.
+   * @param {(Buffer[]|Buffer)} publicKeys - The public keys to verify the signatures against, in the same order as `messages`, or a single public key to use for every message.
+   * @returns {Promise<boolean[]>} - A Promise that resolves to whether each message has a valid signature from the owner of the corresponding public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::verifyBatchAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<Napi::Object> buffers;
+    const std::vector<BatchItem> items = parseBatch(info, buffers);
+    buffers.push_back(Value());
+    return AsyncJob::run<std::vector<bool>>(
+      env,
+      buffers,
+      [this, items]() -> std::vector<bool> {
+        return verifyBatchItems(*oqsSig, items);
+      },
+      [](Napi::Env cbEnv, std::vector<bool>& results) -> Napi::Value {
+        return batchResultsToArray(cbEnv, results);
+      }
+    );
+  }
+
+  /**
+   * Verifies a batch of signatures in one call and checks that all of them are valid.
+   * Stops verifying as soon as an invalid signature is found.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @name verifyAll
+   * @param {Buffer[]} messages - The messages that were signed.
+   * @param {Buffer[]} signatures - The signatures to verify, in the same order as `messages`.
+   * @param {(Buffer[]|Buffer)} publicKeys - The public keys to verify the signatures against, in the same order as `messages`, or a single public key to use for every message.
+   * @returns {boolean} - Whether every message has a valid signature from the owner of the corresponding public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::verifyAll(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<Napi::Object> buffers;
+    const std::vector<BatchItem> items = parseBatch(info, buffers);
+    return Napi::Boolean::New(env, verifyAllBatchItems(*oqsSig, items));
+  }
+
+  /**
+   * Asynchronously verifies a batch of signatures and checks that all of them are valid.
+   * Stops verifying as soon as an invalid signature is found.
+   * The Buffers must not be modified until the returned Promise settles.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name verifyAllAsync
+   * @param {Buffer[]} messages - The messages that were signed.
+   * @param {Buffer[]} signatures - The signatures to verify, in the same order as `messages`.
+   * @param {(Buffer[]|Buffer)} publicKeys - The public keys to verify the signatures against, in the same order as `messages`, or a single public key to use for every message.
+   * @returns {Promise<boolean>} - A Promise that resolves to whether every message has a valid signature from the owner of the corresponding public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::verifyAllAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<Napi::Object> buffers;
+    const std::vector<BatchItem> items = parseBatch(info, buffers);
+    buffers.push_back(Value());
+    return AsyncJob::run<bool>(
+      env,
+      buffers,
+      [this, items]() -> bool {
+        return verifyAllBatchItems(*oqsSig, items);
+      },
+      [](Napi::Env cbEnv, bool& allValid) -> Napi::Value {
+        return Napi::Boolean::New(cbEnv, allValid);
+      }
+    );
+  }
+
+  /**
+   * Creates a PrehashSigner that signs a message fed to it in chunks, using the instance's secret key.
+   * The signature is made in prehash mode, so it can only be verified with a PrehashVerifier.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @name createSigner
+   * @returns {PrehashSigner} - A new PrehashSigner bound to the instance.
+   */
+  Napi::Value Signature::createSigner(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return AddonData::get(env).prehashSignerConstructor.New({Value()});
+  }
+
+  /**
+   * Creates a PrehashVerifier that verifies a prehash-mode signature over a message fed to it in chunks.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @name createVerifier
+   * @returns {PrehashVerifier} - A new PrehashVerifier for the instance's algorithm.
+   */
+  Napi::Value Signature::createVerifier(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return AddonData::get(env).prehashVerifierConstructor.New({Value()});
+  }
+
+  // Files are read in windows of this size
+  static constexpr std::size_t FILE_WINDOW_SIZE = 8 << 20;
+
+  /**
+   * An object with the following properties:
+   * * `prehash`: Whether to sign in prehash mode, hashing the file in a single pass with constant memory use.
+   *   Prehash signatures are compatible with PrehashSigner and PrehashVerifier.
+   *   If false, the whole file is signed directly, as if it had been read into a Buffer and passed to Signature#sign;
+   *   this reads the whole file into memory at once. Defaults to `true`.
+   * @memberof Signature
+   * @typedef {Object} FileOptions
+   */
+
+  /**
+   * Reads the options object of signFile and verifyFile, returning whether to use prehash mode.
+   */
+  static bool parseFileOptions(const Napi::CallbackInfo& info, std::size_t index) {
+    Napi::Env env = info.Env();
+    if (info.Length() <= index || info[index].IsUndefined()) {
+      return true;
+    }
+    if (!info[index].IsObject()) {
+      throw Napi::TypeError::New(env, "Options must be an object");
+    }
+    const Napi::Value prehash = info[index].As<Napi::Object>().Get("prehash");
+    if (prehash.IsUndefined()) {
+      return true;
+    }
+    if (!prehash.IsBoolean()) {
+      throw Napi::TypeError::New(env, "Prehash must be a boolean");
+    }
+    return prehash.As<Napi::Boolean>().Value();
+  }
+
+  /**
+   * Reads a file and returns the message to sign or verify for it: either the prehash-mode message,
+   * hashed one window at a time, or the whole contents of the file.
+   */
+  static bytes fileMessage(const std::string& path, bool prehash) {
+    FileReader file(path);
+    bytes window(FILE_WINDOW_SIZE);
+    if (prehash) {
+      Prehash::Shake256 hash;
+      while (const std::size_t count = file.read(window.data(), window.size())) {
+        hash.update(window.data(), count);
+      }
+      return hash.signedMessage();
+    }
+    bytes contents;
+    while (const std::size_t count = file.read(window.data(), window.size())) {
+      contents.insert(contents.end(), window.begin(), window.begin() + count);
+    }
+    return contents;
+  }
+
+  /**
+   * Signs a file without reading it into a Buffer. The file is read and hashed in windows on a worker thread,
+   * so large files are signed without blocking the event loop or holding the whole file in memory.
+   * The file should not be modified until the returned Promise settles, or the signature will cover a mix of its contents.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name signFile
+   * @param {string} path - The path of the file to sign.
+   * @param {Signature.FileOptions} [options] - How to sign the file.
+   * @returns {Promise<Buffer>} - A Promise that resolves to the signature for the file.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::signFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Path must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Path must be a string");
+    }
+    const std::string path = info[0].As<Napi::String>().Utf8Value();
+    const bool prehash = parseFileOptions(info, 1);
+    using SignResult = std::pair<Slab::Block, std::size_t>;
+    return AsyncJob::run<SignResult>(
+      env,
+      {Value()},
+      [this, path, prehash]() -> SignResult {
+        const bytes message = fileMessage(path, prehash);
+        SignResult signResult(Slab::Block(oqsSig->get_details().max_length_signature), 0);
+        std::lock_guard<std::mutex> lock(mutex);
+        signResult.second = oqsSig->sign({message.data(), message.size()}, signResult.first.data());
+        return signResult;
+      },
+      [](Napi::Env cbEnv, SignResult& signResult) -> Napi::Value {
+        return Buffers::fromBlock(cbEnv, std::move(signResult.first), signResult.second);
+      }
+    );
+  }
+
+  /**
+   * Verifies the signature of a file without reading it into a Buffer. The file is read and hashed in windows
+   * on a worker thread, so large files are verified without blocking the event loop or holding the whole file in memory.
+   * The Buffers must not be modified until the returned Promise settles, and the file should not be either.
+   * @memberof Signature
+   * @instance
+   * @method
+   * @async
+   * @name verifyFile
+   * @param {string} path - The path of the file that was signed to produce the signature.
+   * @param {Buffer} signature - The signature to verify.
+   * @param {Buffer} publicKey - The public key of the signer.
+   * @param {Signature.FileOptions} [options] - How the file was signed.
+   * @returns {Promise<boolean>} - A Promise that resolves to whether the file has a valid signature from the owner of the public key.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::verifyFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Path must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Path must be a string");
+    }
+    if (info.Length() < 3) {
+      throw Napi::TypeError::New(env, "Signature and public key must be buffers");
+    }
+    if (!info[1].IsBuffer() || !info[2].IsBuffer()) {
+      throw Napi::TypeError::New(env, "Signature and public key must be buffers");
+    }
+    const std::string path = info[0].As<Napi::String>().Utf8Value();
+    const auto signatureBuffer = info[1].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span signature{signatureBuffer.Data(), signatureBuffer.Length()};
+    const auto publicKeyBuffer = info[2].As<Napi::Buffer<byte>>();
+    const oqs_span::byte_span publicKey{publicKeyBuffer.Data(), publicKeyBuffer.Length()};
+    const bool prehash = parseFileOptions(info, 3);
+    return AsyncJob::run<bool>(
+      env,
+      {Value(), signatureBuffer, publicKeyBuffer},
+      [this, path, signature, publicKey, prehash]() -> bool {
+        const bytes message = fileMessage(path, prehash);
+        return oqsSig->verify({message.data(), message.size()}, signature, publicKey);
+      },
+      [](Napi::Env cbEnv, bool& valid) -> Napi::Value {
+        return Napi::Boolean::New(cbEnv, valid);
+      }
+    );
+  }
+
+  bytes Signature::signBytes(oqs_span::byte_span message) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return oqsSig->sign(message);
+  }
+
+  bool Signature::verifyBytes(oqs_span::byte_span message, oqs_span::byte_span signature, oqs_span::byte_span publicKey) const {
+    return oqsSig->verify(message, signature, publicKey);
+  }
+
+  /**
+   * An object with the following properties:
+   * * `publicKeys`: The public keys, concatenated in order. The i-th public key starts at offset `i * publicKeyLength`.
+   * * `secretKeys`: The secret keys, concatenated in order, in memory that is locked into RAM where possible
+   *   and cleansed when the Buffer is garbage collected. The i-th secret key starts at offset `i * secretKeyLength`.
+   * * `publicKeyLength`: The length of each public key.
+   * * `secretKeyLength`: The length of each secret key.
+   * * `count`: The number of keypairs.
+   * @memberof Signature
+   * @typedef {Object} KeypairBatch
+   */
+
+  /**
+   * Generates many keypairs in one call, spreading the work over the threads of the {@link ThreadPool}.
+   * The keys are packed into one public key Buffer and one secret key Buffer, rather than needing an instance,
+   * a generateKeypair call and an exportSecretKey call per keypair.
+   * @memberof Signature
+   * @name generateKeypairs
+   * @static
+   * @method
+   * @param {Sigs.Algorithm} algorithm - The signature algorithm to use.
+   * @param {number} count - The number of keypairs to generate.
+   * @returns {Signature.KeypairBatch} - The packed public and secret keys.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   * @throws {Error} Will throw an error if memory cannot be allocated or key generation fails.
+   */
+  Napi::Value Signature::generateKeypairs(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::string algorithm;
+    std::size_t count;
+    KeypairBatch::parseArguments(info, algorithm, count);
+    std::unique_ptr<oqs_span::Signature> scheme;
+    try {
+      scheme = std::make_unique<oqs_span::Signature>(algorithm);
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+    try {
+      KeypairBatch::Batch batch = KeypairBatch::generate(*scheme, count);
+      return KeypairBatch::toObject(env, batch);
+    } catch (const std::exception& ex) {
+      throw Napi::Error::New(env, ex.what());
+    }
+  }
+
+  /**
+   * Asynchronously generates many keypairs, spreading the work over the threads of the {@link ThreadPool}
+   * without blocking the event loop.
+   * @memberof Signature
+   * @name generateKeypairsAsync
+   * @static
+   * @method
+   * @async
+   * @param {Sigs.Algorithm} algorithm - The signature algorithm to use.
+   * @param {number} count - The number of keypairs to generate.
+   * @returns {Promise<Signature.KeypairBatch>} - A Promise that resolves to the packed public and secret keys.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value Signature::generateKeypairsAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::string algorithm;
+    std::size_t count;
+    KeypairBatch::parseArguments(info, algorithm, count);
+    std::shared_ptr<const oqs_span::Signature> scheme;
+    try {
+      scheme = std::make_shared<const oqs_span::Signature>(algorithm);
+    } catch (const std::exception& ex) {
+      throw Napi::TypeError::New(env, ex.what());
+    }
+    return AsyncJob::run<KeypairBatch::Batch>(
+      env,
+      {},
+      [scheme, count]() -> KeypairBatch::Batch {
+        return KeypairBatch::generate(*scheme, count);
+      },
+      [](Napi::Env cbEnv, KeypairBatch::Batch& batch) -> Napi::Value {
+        return KeypairBatch::toObject(cbEnv, batch);
+      }
+    );
+  }
+
   void Signature::Init(Napi::Env env, Napi::Object exports) {
     Napi::Function func = DefineClass(env, "Signature", {
       InstanceMethod<&Signature::getDetails>("getDetails"),
       InstanceMethod<&Signature::generateKeypair>("generateKeypair"),
       InstanceMethod<&Signature::exportSecretKey>("exportSecretKey"),
       InstanceMethod<&Signature::sign>("sign"),
-      InstanceMethod<&Signature::verify>("verify")
+      InstanceMethod<&Signature::verify>("verify"),
+      InstanceMethod<&Signature::generateKeypairAsync>("generateKeypairAsync"),
+      InstanceMethod<&Signature::signAsync>("signAsync"),
+      InstanceMethod<&Signature::verifyAsync>("verifyAsync"),
+      InstanceMethod<&Signature::verifyBatch>("verifyBatch"),
+      InstanceMethod<&Signature::verifyBatchAsync>("verifyBatchAsync"),
+      InstanceMethod<&Signature::verifyAll>("verifyAll"),
+      InstanceMethod<&Signature::verifyAllAsync>("verifyAllAsync"),
+      InstanceMethod<&Signature::createSigner>("createSigner"),
+      InstanceMethod<&Signature::createVerifier>("createVerifier"),
+      InstanceMethod<&Signature::signFile>("signFile"),
+      InstanceMethod<&Signature::verifyFile>("verifyFile"),
+      StaticMethod<&Signature::generateKeypairs>("generateKeypairs"),
+      StaticMethod<&Signature::generateKeypairsAsync>("generateKeypairsAsync")
     });
-    Napi::FunctionReference* constructor = new Napi::FunctionReference();
-    *constructor = Napi::Persistent(func);
+    AddonData::get(env).signatureConstructor = Napi::Persistent(func);
     exports.Set(
       Napi::String::New(env, "Signature"),
       func
     );
-    env.SetInstanceData<Napi::FunctionReference>(constructor);
   }
 
   void Init(Napi::Env env, Napi::Object exports) {
@@ -1,16 +1,21 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <napi.h>
 
 // liboqs-cpp
 #include "oqs_cpp.h"
 
+#include "oqs_span.h"
+
 namespace Signature {
 
   class Signature : public Napi::ObjectWrap<Signature> {
     private:
-      std::unique_ptr<oqs::Signature> oqsSig;
+      std::unique_ptr<oqs_span::Signature> oqsSig;
+      // Guards oqsSig against concurrent use by async jobs
+      std::mutex mutex;
 
     public:
       explicit Signature(const Napi::CallbackInfo& info);
@@ -19,6 +24,24 @@ namespace Signature {
       Napi::Value exportSecretKey(const Napi::CallbackInfo& info);
       Napi::Value sign(const Napi::CallbackInfo& info);
       Napi::Value verify(const Napi::CallbackInfo& info);
+      Napi::Value generateKeypairAsync(const Napi::CallbackInfo& info);
+      Napi::Value signAsync(const Napi::CallbackInfo& info);
+      Napi::Value verifyAsync(const Napi::CallbackInfo& info);
+      Napi::Value verifyBatch(const Napi::CallbackInfo& info);
+      Napi::Value verifyBatchAsync(const Napi::CallbackInfo& info);
+      Napi::Value verifyAll(const Napi::CallbackInfo& info);
+      Napi::Value verifyAllAsync(const Napi::CallbackInfo& info);
+      Napi::Value createSigner(const Napi::CallbackInfo& info);
+      Napi::Value createVerifier(const Napi::CallbackInfo& info);
+      Napi::Value signFile(const Napi::CallbackInfo& info);
+      Napi::Value verifyFile(const Napi::CallbackInfo& info);
+
+      // Signs and verifies raw messages for other native classes
+      oqs::bytes signBytes(oqs_span::byte_span message);
+      bool verifyBytes(oqs_span::byte_span message, oqs_span::byte_span signature, oqs_span::byte_span publicKey) const;
+
+      static Napi::Value generateKeypairs(const Napi::CallbackInfo& info);
+      static Napi::Value generateKeypairsAsync(const Napi::CallbackInfo& info);
 
       static void Init(Napi::Env env, Napi::Object exports);
   };
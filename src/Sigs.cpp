@@ -2,13 +2,13 @@
 
 #include "Sigs.h"
 
-#include <cstdint>
-#include <vector>
 #include <napi.h>
 
 // liboqs-cpp
 #include "oqs_cpp.h"
 
+#include "Algorithms.h"
+
 /** @namespace Sigs */
 namespace Sigs {
 
@@ -21,6 +21,7 @@ namespace Sigs {
 
   /**
    * Gets an array of signature algorithms that were enabled at compile-time and are available for use.
+   * Every call returns the same frozen array.
    * @memberof Sigs
    * @name getEnabledAlgorithms
    * @static
@@ -29,21 +30,7 @@ namespace Sigs {
    */
   Napi::Value getEnabledAlgorithms(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    const std::vector<std::string> enabledSigs = oqs::Sigs::get_enabled_sigs();
-    std::size_t numDefaultSigs = 0;
-    for (auto sig : enabledSigs) {
-      // Not expecting any other default algorithms to be created
-      if (sig == "DEFAULT") {
-        numDefaultSigs++;
-      }
-    }
-    auto enabledSigsArray = Napi::Array::New(env, enabledSigs.size() - numDefaultSigs);
-    for (std::size_t i = 0; auto sig : enabledSigs) {
-      if (sig != "DEFAULT") {
-        enabledSigsArray[i++] = sig;
-      }
-    }
-    return enabledSigsArray;
+    return Algorithms::sigNames(env);
   }
 
   /**
@@ -65,13 +52,37 @@ namespace Sigs {
       throw Napi::TypeError::New(env, "Algorithm must be a string");
     }
     const auto algorithm = info[0].As<Napi::String>().Utf8Value();
+    const auto& byName = Algorithms::sigs().byName;
+    const auto entry = byName.find(algorithm);
     auto isEnabled = Napi::Boolean::New(
       env,
-      oqs::Sigs::is_sig_enabled(algorithm)
+      entry != byName.end() && entry->second != nullptr
     );
     return isEnabled;
   }
 
+  /**
+   * Gets the details of an algorithm without constructing an instance.
+   * Every call returns the same frozen object, which is also returned by Signature#getDetails.
+   * @memberof Sigs
+   * @name getDetails
+   * @static
+   * @method
+   * @param {Sigs.Algorithm} algorithm - The algorithm to get the details of.
+   * @returns {Object} - An object containing the details of the signature algorithm.
+   * @throws {TypeError} Will throw an error if any argument is invalid, or if the algorithm is not enabled.
+   */
+  Napi::Value getDetails(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    if (!info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Algorithm must be a string");
+    }
+    return Algorithms::sigDetails(env, info[0].As<Napi::String>().Utf8Value());
+  }
+
   void Init(Napi::Env env, Napi::Object exports) {
     auto SigsExports = Napi::Object::New(env);
     SigsExports.Set(
@@ -82,6 +93,10 @@ namespace Sigs {
       Napi::String::New(env, "isAlgorithmEnabled"),
       Napi::Function::New(env, isAlgorithmEnabled)
     );
+    SigsExports.Set(
+      Napi::String::New(env, "getDetails"),
+      Napi::Function::New(env, getDetails)
+    );
     exports.Set(
       Napi::String::New(env, "Sigs"),
       SigsExports
@@ -0,0 +1,22 @@
+#include "Slab.h"
+
+#include "SlotAllocator.h"
+
+namespace Slab {
+
+  /**
+   * Intentionally never freed, since Buffers may release slots during exit.
+   * Power-of-two classes up to 16 KiB cover the ciphertexts, public keys and signatures of the common algorithms;
+   * larger outputs (Classic McEliece keys, most SPHINCS+ signatures) go to the heap.
+   */
+  SlotAllocator& allocator() {
+    static auto* instance = new SlotAllocator({
+      {64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384},
+      256 * 1024,
+      16,
+      false
+    });
+    return *instance;
+  }
+
+} // namespace Slab
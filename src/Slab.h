@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#include "SlotAllocator.h"
+
+/**
+ * An allocator for public outputs whose length is fixed per algorithm (public keys, ciphertexts and signatures).
+ * Outputs are written straight into recycled slots of power-of-two size classes, so producing one does not
+ * need a heap allocation or a copy. Unlike the SecureArena, slots are neither locked into RAM nor cleansed.
+ * Safe to use from any thread.
+ */
+namespace Slab {
+
+  /**
+   * The slabs, shared by every thread of the process.
+   */
+  SlotAllocator& allocator();
+
+  /**
+   * Owns memory from the slabs until it is released or handed over, for example to a Buffer.
+   */
+  class Block : public SlotAllocator::Block {
+    public:
+      Block() = default;
+
+      explicit Block(std::size_t size) : SlotAllocator::Block(Slab::allocator(), size) {}
+  };
+
+}
@@ -0,0 +1,153 @@
+#include "SlotAllocator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <utility>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define SLOT_ALLOCATOR_MMAP 1
+#endif
+
+using oqs::byte;
+
+SlotAllocator::SlotAllocator(Options options)
+  : options(std::move(options)), classes(new SizeClass[this->options.slotSizes.size()]) {}
+
+int SlotAllocator::classFor(std::size_t size) const {
+  for (std::size_t i = 0; i < options.slotSizes.size(); i++) {
+    if (size <= options.slotSizes[i]) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+/**
+ * Maps a new region. Secure regions are locked into RAM and excluded from core dumps.
+ * Locking is best-effort: over RLIMIT_MEMLOCK the region is still used, but may be swapped out.
+ */
+byte* SlotAllocator::mapRegion(std::size_t size) const {
+  if (!options.secure) {
+    return static_cast<byte*>(std::malloc(size));
+  }
+#ifdef SLOT_ALLOCATOR_MMAP
+  void* region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (region == MAP_FAILED) {
+    return nullptr;
+  }
+  mlock(region, size);
+#ifdef MADV_DONTDUMP
+  madvise(region, size, MADV_DONTDUMP);
+#endif
+  return static_cast<byte*>(region);
+#else
+  return nullptr;
+#endif
+}
+
+/**
+ * Maps memory for a single secure allocation larger than the biggest slot, with the same protections as a region.
+ * Returns nullptr if it cannot be mapped, so that it comes from the heap instead.
+ */
+byte* SlotAllocator::mapDedicated(std::size_t size) {
+  byte* data = mapRegion(size);
+  if (data != nullptr) {
+    std::lock_guard<std::mutex> lock(dedicatedMutex);
+    try {
+      dedicated.insert(data);
+    } catch (const std::bad_alloc&) {
+      unmap(data, size);
+      return nullptr;
+    }
+  }
+  return data;
+}
+
+/**
+ * Unmaps memory returned by mapRegion().
+ */
+void SlotAllocator::unmap(byte* data, std::size_t size) const noexcept {
+#ifdef SLOT_ALLOCATOR_MMAP
+  munmap(data, size);
+#else
+  static_cast<void>(data);
+  static_cast<void>(size);
+#endif
+}
+
+byte* SlotAllocator::allocate(std::size_t size) {
+  const int classIndex = classFor(size);
+  if (classIndex >= 0) {
+    SizeClass& sizeClass = classes[classIndex];
+    const std::size_t slotSize = options.slotSizes[classIndex];
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    if (sizeClass.freeList == nullptr && sizeClass.regions.size() < options.maxRegionsPerClass) {
+      const std::size_t regionSize = std::max(options.regionSize, slotSize * 8);
+      byte* region = mapRegion(regionSize);
+      if (region != nullptr) {
+        sizeClass.regions.emplace_back(region, region + regionSize);
+        for (std::size_t offset = regionSize; offset >= slotSize; offset -= slotSize) {
+          auto slot = reinterpret_cast<FreeSlot*>(region + offset - slotSize);
+          slot->next = sizeClass.freeList;
+          sizeClass.freeList = slot;
+        }
+      }
+    }
+    if (sizeClass.freeList != nullptr) {
+      FreeSlot* slot = sizeClass.freeList;
+      sizeClass.freeList = slot->next;
+      slot->next = nullptr;
+      return reinterpret_cast<byte*>(slot);
+    }
+  }
+  if (classIndex < 0 && options.secure) {
+    byte* data = mapDedicated(size);
+    if (data != nullptr) {
+      return data;
+    }
+  }
+  // Zero-length Buffers still need a unique pointer to release
+  byte* data = new (std::nothrow) byte[size > 0 ? size : 1];
+  if (data == nullptr) {
+    throw std::bad_alloc();
+  }
+  return data;
+}
+
+void SlotAllocator::release(byte* data, std::size_t size) noexcept {
+  if (data == nullptr) {
+    return;
+  }
+  if (options.secure) {
+    OQS_MEM_cleanse(data, size);
+  }
+  const int classIndex = classFor(size);
+  if (classIndex >= 0) {
+    SizeClass& sizeClass = classes[classIndex];
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    for (const auto& region : sizeClass.regions) {
+      if (data >= region.first && data < region.second) {
+        auto slot = reinterpret_cast<FreeSlot*>(data);
+        slot->next = sizeClass.freeList;
+        sizeClass.freeList = slot;
+        return;
+      }
+    }
+  }
+  if (classIndex < 0 && options.secure) {
+    std::unique_lock<std::mutex> lock(dedicatedMutex);
+    if (dedicated.erase(data) > 0) {
+      lock.unlock();
+      unmap(data, size);
+      return;
+    }
+  }
+  delete[] data;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+
+/**
+ * Hands out fixed-size slots carved out of large regions, recycling released slots through per-size free lists.
+ * Requests made once a size class has used all of its regions fall back to the heap.
+ * Requests larger than the biggest slot do too, except that a secure allocator first tries to give them
+ * a dedicated mapping with the same protections as a region.
+ * Safe to use from any thread.
+ */
+class SlotAllocator {
+  public:
+    struct Options {
+      // Slot sizes in increasing order
+      std::vector<std::size_t> slotSizes;
+      // Size of each region; regions of big slots are enlarged to hold at least eight of them
+      std::size_t regionSize;
+      std::size_t maxRegionsPerClass;
+      // Lock regions into RAM, exclude them from core dumps and cleanse memory on release
+      bool secure;
+    };
+
+    /**
+     * Owns memory from an allocator until it is released or handed over, for example to a Buffer.
+     */
+    class Block {
+      private:
+        SlotAllocator* allocator_;
+        oqs::byte* data_;
+        std::size_t size_;
+
+      public:
+        Block() : allocator_(nullptr), data_(nullptr), size_(0) {}
+
+        Block(SlotAllocator& allocator, std::size_t size)
+          : allocator_(&allocator), data_(allocator.allocate(size)), size_(size) {}
+
+        Block(Block&& other) noexcept : allocator_(other.allocator_), data_(other.data_), size_(other.size_) {
+          other.data_ = nullptr;
+          other.size_ = 0;
+        }
+
+        Block& operator=(Block&& other) noexcept {
+          if (this != &other) {
+            reset();
+            allocator_ = other.allocator_;
+            data_ = other.data_;
+            size_ = other.size_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+          }
+          return *this;
+        }
+
+        Block(const Block&) = delete;
+        Block& operator=(const Block&) = delete;
+
+        ~Block() {
+          reset();
+        }
+
+        oqs::byte* data() const {
+          return data_;
+        }
+
+        std::size_t size() const {
+          return size_;
+        }
+
+        /**
+         * Gives up ownership. The caller becomes responsible for passing the memory to the allocator's release().
+         */
+        oqs::byte* relinquish() {
+          oqs::byte* data = data_;
+          data_ = nullptr;
+          size_ = 0;
+          return data;
+        }
+
+        void reset() {
+          if (data_ != nullptr) {
+            allocator_->release(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+          }
+        }
+    };
+
+    explicit SlotAllocator(Options options);
+    SlotAllocator(const SlotAllocator&) = delete;
+    SlotAllocator& operator=(const SlotAllocator&) = delete;
+
+    /**
+     * Allocates `size` bytes. Throws std::bad_alloc if no memory is available.
+     */
+    oqs::byte* allocate(std::size_t size);
+
+    /**
+     * Releases memory returned by allocate(). `size` must be the size it was allocated with.
+     */
+    void release(oqs::byte* data, std::size_t size) noexcept;
+
+  private:
+    struct FreeSlot {
+      FreeSlot* next;
+    };
+
+    struct SizeClass {
+      std::mutex mutex;
+      FreeSlot* freeList = nullptr;
+      // Start and end of every region carved into slots of this class
+      std::vector<std::pair<oqs::byte*, oqs::byte*>> regions;
+    };
+
+    const Options options;
+    std::unique_ptr<SizeClass[]> classes;
+
+    // Dedicated mappings that are currently allocated, so release() can tell them from heap allocations
+    std::mutex dedicatedMutex;
+    std::unordered_set<oqs::byte*> dedicated;
+
+    int classFor(std::size_t size) const;
+    oqs::byte* mapRegion(std::size_t size) const;
+    oqs::byte* mapDedicated(std::size_t size);
+    void unmap(oqs::byte* data, std::size_t size) const noexcept;
+};
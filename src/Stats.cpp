@@ -0,0 +1,245 @@
+// exports.Stats
+
+#include "Stats.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <napi.h>
+
+/** @namespace Stats */
+namespace Stats {
+
+  std::atomic<bool> enabled(false);
+
+  static const std::array<const char*, OPERATION_COUNT> OPERATION_NAMES = {
+    "generateKeypair",
+    "encapsulateSecret",
+    "decapsulateSecret",
+    "sign",
+    "verify"
+  };
+
+  void OperationStats::record(std::chrono::nanoseconds elapsed, std::uint64_t in, std::uint64_t out, bool failed) {
+    const auto elapsedNs = static_cast<std::uint64_t>(elapsed.count());
+    calls.fetch_add(1, std::memory_order_relaxed);
+    if (failed) {
+      failures.fetch_add(1, std::memory_order_relaxed);
+    }
+    bytesIn.fetch_add(in, std::memory_order_relaxed);
+    bytesOut.fetch_add(out, std::memory_order_relaxed);
+    totalTimeNs.fetch_add(elapsedNs, std::memory_order_relaxed);
+    std::size_t bucket = 0;
+    while (bucket < BUCKET_BOUNDS_US.size() && elapsedNs > BUCKET_BOUNDS_US[bucket] * 1000) {
+      bucket++;
+    }
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void OperationStats::reset() {
+    calls.store(0, std::memory_order_relaxed);
+    failures.store(0, std::memory_order_relaxed);
+    bytesIn.store(0, std::memory_order_relaxed);
+    bytesOut.store(0, std::memory_order_relaxed);
+    totalTimeNs.store(0, std::memory_order_relaxed);
+    for (auto& bucket : buckets) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  struct Registry {
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<AlgorithmStats>> algorithms;
+  };
+
+  /**
+   * The stats of every algorithm that has been used, shared by every environment that loads the addon.
+   * Intentionally never freed, since instances keep references into it.
+   */
+  static Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+  }
+
+  AlgorithmStats& forAlgorithm(const std::string& algorithm) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto& algorithmStats = reg.algorithms[algorithm];
+    if (!algorithmStats) {
+      algorithmStats = std::make_unique<AlgorithmStats>();
+    }
+    return *algorithmStats;
+  }
+
+  /**
+   * Turns recording of operation stats on or off. Recording is off by default, and costs next to nothing while off.
+   * Stats are shared by every thread of the process, including worker threads.
+   * @memberof Stats
+   * @name setEnabled
+   * @static
+   * @method
+   * @param {boolean} enabled - Whether to record operation stats.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value setEnabled(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Enabled must be a boolean");
+    }
+    if (!info[0].IsBoolean()) {
+      throw Napi::TypeError::New(env, "Enabled must be a boolean");
+    }
+    enabled.store(info[0].As<Napi::Boolean>().Value(), std::memory_order_relaxed);
+    return env.Undefined();
+  }
+
+  /**
+   * Checks whether operation stats are being recorded.
+   * @memberof Stats
+   * @name isEnabled
+   * @static
+   * @method
+   * @returns {boolean} - Whether operation stats are being recorded.
+   */
+  Napi::Value isEnabled(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return Napi::Boolean::New(env, recording());
+  }
+
+  /**
+   * The recorded stats of one operation of one algorithm.
+   * @memberof Stats
+   * @typedef {Object} OperationStats
+   * @property {number} calls - The number of calls, including failed ones.
+   * @property {number} failures - The number of calls that failed. A signature that is found to be invalid does not count as a failure.
+   * @property {number} bytesIn - The total size of the keys, ciphertexts, messages and signatures passed in.
+   * @property {number} bytesOut - The total size of the keys, ciphertexts, shared secrets and signatures produced.
+   * @property {number} totalTimeUs - The total time spent in liboqs, in microseconds.
+   * @property {number[]} histogram - The number of calls in each latency bucket; see {@link Stats.Snapshot}.
+   */
+
+  /**
+   * A snapshot of the recorded operation stats.
+   * * `enabled`: Whether operation stats are being recorded.
+   * * `bucketBoundsUs`: The inclusive upper bounds of the latency histogram buckets in microseconds.
+   *   Each histogram has one more bucket than there are bounds, for calls slower than the last bound.
+   * * `algorithms`: For every algorithm that has been used, an object mapping the name of each operation
+   *   (`generateKeypair`, `encapsulateSecret`, `decapsulateSecret`, `sign` or `verify`) that has been called
+   *   to its {@link Stats.OperationStats}.
+   * @memberof Stats
+   * @typedef {Object} Snapshot
+   */
+
+  /**
+   * Gets the operation stats recorded since recording was enabled or the stats were last reset.
+   * Operations are counted however they are called, including asynchronously and in batches.
+   * @memberof Stats
+   * @name getStats
+   * @static
+   * @method
+   * @returns {Stats.Snapshot} - The recorded stats.
+   */
+  Napi::Value getStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    auto statsObj = Napi::Object::New(env);
+    statsObj.Set(
+      Napi::String::New(env, "enabled"),
+      Napi::Boolean::New(env, recording())
+    );
+    auto boundsArray = Napi::Array::New(env, BUCKET_BOUNDS_US.size());
+    for (std::uint32_t i = 0; i < BUCKET_BOUNDS_US.size(); i++) {
+      boundsArray[i] = Napi::Number::New(env, BUCKET_BOUNDS_US[i]);
+    }
+    statsObj.Set(
+      Napi::String::New(env, "bucketBoundsUs"),
+      boundsArray
+    );
+    auto algorithmsObj = Napi::Object::New(env);
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& [algorithm, algorithmStats] : reg.algorithms) {
+      auto operationsObj = Napi::Object::New(env);
+      for (std::size_t op = 0; op < OPERATION_COUNT; op++) {
+        const OperationStats& operationStats = algorithmStats->operations[op];
+        const std::uint64_t calls = operationStats.calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+          continue;
+        }
+        auto operationObj = Napi::Object::New(env);
+        operationObj["calls"] = Napi::Number::New(env, calls);
+        operationObj["failures"] = Napi::Number::New(env, operationStats.failures.load(std::memory_order_relaxed));
+        operationObj["bytesIn"] = Napi::Number::New(env, operationStats.bytesIn.load(std::memory_order_relaxed));
+        operationObj["bytesOut"] = Napi::Number::New(env, operationStats.bytesOut.load(std::memory_order_relaxed));
+        operationObj["totalTimeUs"] = Napi::Number::New(env, operationStats.totalTimeNs.load(std::memory_order_relaxed) / 1e3);
+        auto histogramArray = Napi::Array::New(env, BUCKET_COUNT);
+        for (std::uint32_t i = 0; i < BUCKET_COUNT; i++) {
+          histogramArray[i] = Napi::Number::New(env, operationStats.buckets[i].load(std::memory_order_relaxed));
+        }
+        operationObj["histogram"] = histogramArray;
+        operationsObj.Set(
+          Napi::String::New(env, OPERATION_NAMES[op]),
+          operationObj
+        );
+      }
+      algorithmsObj.Set(
+        Napi::String::New(env, algorithm),
+        operationsObj
+      );
+    }
+    statsObj.Set(
+      Napi::String::New(env, "algorithms"),
+      algorithmsObj
+    );
+    return statsObj;
+  }
+
+  /**
+   * Resets every recorded operation stat to zero.
+   * @memberof Stats
+   * @name resetStats
+   * @static
+   * @method
+   */
+  Napi::Value resetStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& entry : reg.algorithms) {
+      for (auto& operationStats : entry.second->operations) {
+        operationStats.reset();
+      }
+    }
+    return env.Undefined();
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    auto statsExports = Napi::Object::New(env);
+    statsExports.Set(
+      Napi::String::New(env, "setEnabled"),
+      Napi::Function::New(env, setEnabled)
+    );
+    statsExports.Set(
+      Napi::String::New(env, "isEnabled"),
+      Napi::Function::New(env, isEnabled)
+    );
+    statsExports.Set(
+      Napi::String::New(env, "getStats"),
+      Napi::Function::New(env, getStats)
+    );
+    statsExports.Set(
+      Napi::String::New(env, "resetStats"),
+      Napi::Function::New(env, resetStats)
+    );
+    exports.Set(
+      Napi::String::New(env, "Stats"),
+      statsExports
+    );
+  }
+
+} // namespace Stats
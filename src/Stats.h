@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <napi.h>
+
+namespace Stats {
+
+  enum class Operation : std::size_t {
+    GenerateKeypair,
+    EncapsulateSecret,
+    DecapsulateSecret,
+    Sign,
+    Verify
+  };
+
+  constexpr std::size_t OPERATION_COUNT = 5;
+
+  // Upper bounds of the latency histogram buckets in microseconds; a final bucket catches everything slower
+  constexpr std::array<std::uint64_t, 19> BUCKET_BOUNDS_US = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500,
+    1000, 2000, 5000, 10000, 20000, 50000,
+    100000, 200000, 500000, 1000000
+  };
+
+  constexpr std::size_t BUCKET_COUNT = BUCKET_BOUNDS_US.size() + 1;
+
+  struct OperationStats {
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> failures;
+    std::atomic<std::uint64_t> bytesIn;
+    std::atomic<std::uint64_t> bytesOut;
+    std::atomic<std::uint64_t> totalTimeNs;
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets;
+
+    void record(std::chrono::nanoseconds elapsed, std::uint64_t in, std::uint64_t out, bool failed);
+    void reset();
+  };
+
+  struct AlgorithmStats {
+    std::array<OperationStats, OPERATION_COUNT> operations;
+
+    OperationStats& operator[](Operation operation) {
+      return operations[static_cast<std::size_t>(operation)];
+    }
+  };
+
+  extern std::atomic<bool> enabled;
+
+  /**
+   * Checks whether operations are being recorded. Cheap enough for every hot path.
+   */
+  inline bool recording() {
+    return enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Gets the stats of an algorithm, creating them on first use. The reference stays valid for the life of the process.
+   */
+  AlgorithmStats& forAlgorithm(const std::string& algorithm);
+
+  /**
+   * Records one operation from construction until destruction, as a failure unless succeed() was called.
+   * Does nothing at all, not even reading the clock, while stats are disabled.
+   */
+  class Timer {
+    private:
+      OperationStats* stats;
+      std::chrono::steady_clock::time_point start;
+      std::uint64_t bytesIn;
+      bool done;
+
+    public:
+      Timer(AlgorithmStats& algorithmStats, Operation operation, std::size_t in)
+        : stats(recording() ? &algorithmStats[operation] : nullptr), bytesIn(in), done(false) {
+        if (stats != nullptr) {
+          start = std::chrono::steady_clock::now();
+        }
+      }
+
+      Timer(const Timer&) = delete;
+      Timer& operator=(const Timer&) = delete;
+
+      void succeed(std::size_t bytesOut) {
+        if (stats != nullptr) {
+          stats->record(std::chrono::steady_clock::now() - start, bytesIn, bytesOut, false);
+        }
+        done = true;
+      }
+
+      ~Timer() {
+        if (stats != nullptr && !done) {
+          stats->record(std::chrono::steady_clock::now() - start, bytesIn, 0, true);
+        }
+      }
+  };
+
+  Napi::Value setEnabled(const Napi::CallbackInfo& info);
+  Napi::Value isEnabled(const Napi::CallbackInfo& info);
+  Napi::Value getStats(const Napi::CallbackInfo& info);
+  Napi::Value resetStats(const Napi::CallbackInfo& info);
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
@@ -0,0 +1,380 @@
+// exports.ThreadPool
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <napi.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+/** @namespace ThreadPool */
+namespace ThreadPool {
+
+  // Longest thread name that Linux accepts, excluding the terminator
+  static constexpr std::size_t MAX_THREAD_NAME_LENGTH = 15;
+  static constexpr std::size_t MAX_THREADS = 1024;
+
+  /**
+   * Names the calling thread and pins it to a CPU, where the platform supports it.
+   * Both are best-effort; failures leave the thread as it was.
+   */
+  static void setUpThread(const std::string& name, const std::vector<unsigned int>& affinity, std::size_t index) {
+    const std::string threadName = (name + "-" + std::to_string(index)).substr(0, MAX_THREAD_NAME_LENGTH);
+#if defined(__linux__)
+    pthread_setname_np(pthread_self(), threadName.c_str());
+    if (!affinity.empty()) {
+      const unsigned int cpu = affinity[index % affinity.size()];
+      if (cpu < CPU_SETSIZE) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+      }
+    }
+#elif defined(__APPLE__)
+    pthread_setname_np(threadName.c_str());
+#endif
+  }
+
+  /**
+   * A fixed set of worker threads, each with its own task queue.
+   * A worker runs its newest task first and steals the oldest task of another worker when its own queue is empty.
+   */
+  class Pool {
+    private:
+      struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+      };
+
+      const Options options;
+      std::vector<std::unique_ptr<Queue>> queues;
+      std::vector<std::thread> threads;
+      std::atomic<std::size_t> nextQueue;
+      // Guards pending and stopping, and is what idle workers sleep on
+      std::mutex sleepMutex;
+      std::condition_variable wake;
+      // Tasks that have been queued but not yet taken; briefly negative if a task is taken before it is counted
+      std::ptrdiff_t pending;
+      bool stopping;
+      std::mutex joinMutex;
+      bool joined;
+
+      bool take(std::size_t self, std::function<void()>& task);
+      void work(std::size_t index);
+
+    public:
+      explicit Pool(Options options);
+      Pool(const Pool&) = delete;
+      Pool& operator=(const Pool&) = delete;
+      ~Pool();
+
+      bool submit(std::function<void()>& task);
+      void shutdown();
+      const Options& getOptions() const;
+  };
+
+  // The pool and queue index of the calling thread, if it is a worker
+  static thread_local Pool* currentPool = nullptr;
+  static thread_local std::size_t currentIndex = 0;
+
+  Pool::Pool(Options opts) : options(std::move(opts)), nextQueue(0), pending(0), stopping(false), joined(false) {
+    queues.reserve(options.threads);
+    for (std::size_t i = 0; i < options.threads; i++) {
+      queues.push_back(std::make_unique<Queue>());
+    }
+    threads.reserve(options.threads);
+    for (std::size_t i = 0; i < options.threads; i++) {
+      threads.emplace_back(&Pool::work, this, i);
+    }
+  }
+
+  Pool::~Pool() {
+    shutdown();
+  }
+
+  /**
+   * Queues a task, unless the pool is stopping, in which case `task` is left untouched and false is returned.
+   * The task is counted under the same lock that shutdown() sets `stopping` under,
+   * so every accepted task is run before the workers exit.
+   */
+  bool Pool::submit(std::function<void()>& task) {
+    const std::size_t index = currentPool == this ? currentIndex : nextQueue++ % queues.size();
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex);
+      if (stopping) {
+        return false;
+      }
+      {
+        std::lock_guard<std::mutex> queueLock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+      }
+      pending++;
+    }
+    wake.notify_one();
+    return true;
+  }
+
+  bool Pool::take(std::size_t self, std::function<void()>& task) {
+    {
+      Queue& own = *queues[self];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.tasks.empty()) {
+        task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        return true;
+      }
+    }
+    for (std::size_t i = 1; i < queues.size(); i++) {
+      Queue& victim = *queues[(self + i) % queues.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Pool::work(std::size_t index) {
+    currentPool = this;
+    currentIndex = index;
+    setUpThread(options.name, options.affinity, index);
+    for (;;) {
+      std::function<void()> task;
+      if (take(index, task)) {
+        {
+          std::lock_guard<std::mutex> lock(sleepMutex);
+          pending--;
+        }
+        task();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleepMutex);
+      wake.wait(lock, [this]() -> bool {
+        return stopping || pending > 0;
+      });
+      if (stopping && pending <= 0) {
+        return;
+      }
+    }
+  }
+
+  /**
+   * Lets the workers finish every queued task, then joins them. Safe to call more than once.
+   */
+  void Pool::shutdown() {
+    std::lock_guard<std::mutex> joinLock(joinMutex);
+    if (joined) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    joined = true;
+  }
+
+  const Options& Pool::getOptions() const {
+    return options;
+  }
+
+  struct Global {
+    std::mutex mutex;
+    std::shared_ptr<Pool> pool;
+  };
+
+  /**
+   * The process-wide pool, shared by every environment that loads the addon.
+   * Intentionally never freed, so that exiting the process does not wait on the workers.
+   */
+  static Global& global() {
+    static Global* instance = new Global();
+    return *instance;
+  }
+
+  static std::shared_ptr<Pool> getPool() {
+    Global& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    if (!g.pool) {
+      g.pool = std::make_shared<Pool>(defaultOptions());
+    }
+    return g.pool;
+  }
+
+  Options defaultOptions() {
+    return {
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1),
+      "liboqs-node",
+      {}
+    };
+  }
+
+  void submit(std::function<void()> task) {
+    if (currentPool != nullptr && currentPool->submit(task)) {
+      return;
+    }
+    // A replaced pool refuses new work, so that it can drain; by then the global pool has already been swapped,
+    // so retrying reaches the current pool. This covers workers of the old pool and threads holding a stale pool.
+    while (!getPool()->submit(task)) {}
+  }
+
+  void reconfigure(const Options& options) {
+    std::shared_ptr<Pool> oldPool;
+    {
+      Global& g = global();
+      std::lock_guard<std::mutex> lock(g.mutex);
+      oldPool = std::move(g.pool);
+      g.pool = std::make_shared<Pool>(options);
+    }
+    if (oldPool) {
+      // Queued tasks can include slow key generation, so the old pool is drained off the calling thread
+      std::thread([oldPool]() -> void {
+        oldPool->shutdown();
+      }).detach();
+    }
+  }
+
+  Options currentOptions() {
+    return getPool()->getOptions();
+  }
+
+  std::size_t concurrency() {
+    if (currentPool != nullptr) {
+      return currentPool->getOptions().threads;
+    }
+    return getPool()->getOptions().threads;
+  }
+
+  /**
+   * Options for the addon's worker threads, which run every asynchronous operation and the batch methods.
+   * @memberof ThreadPool
+   * @typedef {Object} Options
+   * @property {number} threads - The number of worker threads. Defaults to the number of CPUs.
+   * @property {string} name - The prefix of the worker thread names, which are suffixed with the worker index and truncated to 15 characters. Defaults to `liboqs-node`.
+   * @property {number[]} affinity - The CPUs to pin workers to, assigned round-robin. Only supported on Linux. Defaults to `[]`, which leaves workers unpinned.
+   */
+
+  /**
+   * Replaces the addon's worker threads with ones using the given options.
+   * The pool is shared by every thread of the process, including worker threads.
+   * Work that is already queued is finished by the old threads in the background; this does not wait for it.
+   * @memberof ThreadPool
+   * @name configure
+   * @static
+   * @method
+   * @param {ThreadPool.Options} options - The options to use. Missing options use their defaults.
+   * @throws {TypeError} Will throw an error if any argument is invalid.
+   */
+  Napi::Value configure(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env, "Options must be an object");
+    }
+    if (!info[0].IsObject()) {
+      throw Napi::TypeError::New(env, "Options must be an object");
+    }
+    const auto optionsObj = info[0].As<Napi::Object>();
+    Options options = defaultOptions();
+    const auto threadsValue = optionsObj.Get("threads");
+    if (!threadsValue.IsUndefined()) {
+      if (!threadsValue.IsNumber()) {
+        throw Napi::TypeError::New(env, "Threads must be a number");
+      }
+      const double threads = threadsValue.As<Napi::Number>().DoubleValue();
+      if (!(threads >= 1 && threads <= MAX_THREADS) || threads != static_cast<double>(static_cast<std::int64_t>(threads))) {
+        throw Napi::TypeError::New(env, "Threads must be an integer from 1 to " + std::to_string(MAX_THREADS));
+      }
+      options.threads = static_cast<std::size_t>(threads);
+    }
+    const auto nameValue = optionsObj.Get("name");
+    if (!nameValue.IsUndefined()) {
+      if (!nameValue.IsString()) {
+        throw Napi::TypeError::New(env, "Name must be a string");
+      }
+      options.name = nameValue.As<Napi::String>().Utf8Value();
+    }
+    const auto affinityValue = optionsObj.Get("affinity");
+    if (!affinityValue.IsUndefined()) {
+      if (!affinityValue.IsArray()) {
+        throw Napi::TypeError::New(env, "Affinity must be an array of CPU indices");
+      }
+      const auto affinityArray = affinityValue.As<Napi::Array>();
+      const uint32_t length = affinityArray.Length();
+      for (uint32_t i = 0; i < length; i++) {
+        const auto cpuValue = affinityArray.Get(i);
+        if (!cpuValue.IsNumber()) {
+          throw Napi::TypeError::New(env, "Affinity must be an array of CPU indices");
+        }
+        const double cpu = cpuValue.As<Napi::Number>().DoubleValue();
+        if (!(cpu >= 0 && cpu <= UINT32_MAX) || cpu != static_cast<double>(static_cast<std::int64_t>(cpu))) {
+          throw Napi::TypeError::New(env, "Affinity must be an array of CPU indices");
+        }
+        options.affinity.push_back(static_cast<unsigned int>(cpu));
+      }
+    }
+    reconfigure(options);
+    return env.Undefined();
+  }
+
+  /**
+   * Gets the options that the addon's worker threads are using.
+   * @memberof ThreadPool
+   * @name getOptions
+   * @static
+   * @method
+   * @returns {ThreadPool.Options} - The options in use.
+   */
+  Napi::Value getOptions(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    const Options options = currentOptions();
+    auto optionsObj = Napi::Object::New(env);
+    optionsObj["threads"] = Napi::Number::New(env, options.threads);
+    optionsObj["name"] = Napi::String::New(env, options.name);
+    auto affinityArray = Napi::Array::New(env, options.affinity.size());
+    for (std::uint32_t i = 0; i < options.affinity.size(); i++) {
+      affinityArray[i] = Napi::Number::New(env, options.affinity[i]);
+    }
+    optionsObj["affinity"] = affinityArray;
+    return optionsObj;
+  }
+
+  void Init(Napi::Env env, Napi::Object exports) {
+    auto poolExports = Napi::Object::New(env);
+    poolExports.Set(
+      Napi::String::New(env, "configure"),
+      Napi::Function::New(env, configure)
+    );
+    poolExports.Set(
+      Napi::String::New(env, "getOptions"),
+      Napi::Function::New(env, getOptions)
+    );
+    exports.Set(
+      Napi::String::New(env, "ThreadPool"),
+      poolExports
+    );
+  }
+
+} // namespace ThreadPool
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include <napi.h>
+
+namespace ThreadPool {
+
+  /**
+   * How the addon's worker threads are set up.
+   */
+  struct Options {
+    // Number of worker threads
+    std::size_t threads;
+    // Prefix of the worker thread names, which are suffixed with the worker index
+    std::string name;
+    // CPU indices to pin workers to, assigned round-robin; empty to leave workers unpinned
+    std::vector<unsigned int> affinity;
+  };
+
+  /**
+   * The options that are used when the pool has not been configured.
+   */
+  Options defaultOptions();
+
+  /**
+   * Queues `task` on the addon's worker threads. The pool is started on first use.
+   * Tasks queued from a worker thread go to that worker's own queue; idle workers steal from the others.
+   * `task` must not throw.
+   */
+  void submit(std::function<void()> task);
+
+  /**
+   * Replaces the pool with one using `options`.
+   * Work already queued on the old pool is finished by its threads in the background, without blocking the caller.
+   */
+  void reconfigure(const Options& options);
+
+  /**
+   * Gets the options of the current pool.
+   */
+  Options currentOptions();
+
+  /**
+   * Gets the number of threads that work can be spread over.
+   */
+  std::size_t concurrency();
+
+  Napi::Value configure(const Napi::CallbackInfo& info);
+  Napi::Value getOptions(const Napi::CallbackInfo& info);
+
+  void Init(Napi::Env env, Napi::Object exports);
+
+}
@@ -1,17 +1,35 @@
 #include <napi.h>
 
+#include "AddonData.h"
+#include "Algorithms.h"
+#include "HybridKEM.h"
 #include "KEMs.h"
 #include "KeyEncapsulation.h"
+#include "KeypairPool.h"
+#include "Platform.h"
+#include "PrehashSigner.h"
+#include "PrehashVerifier.h"
 #include "Random.h"
 #include "Signature.h"
 #include "Sigs.h"
+#include "Stats.h"
+#include "ThreadPool.h"
 
 Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
+  AddonData::Init(env);
+  Algorithms::Init(env);
+  HybridKEM::Init(env, exports);
   KEMs::Init(env, exports);
   KeyEncapsulation::Init(env, exports);
+  KeypairPool::Init(env, exports);
+  Platform::Init(env, exports);
+  PrehashSigner::Init(env, exports);
+  PrehashVerifier::Init(env, exports);
   Random::Init(env, exports);
   Signature::Init(env, exports);
   Sigs::Init(env, exports);
+  Stats::Init(env, exports);
+  ThreadPool::Init(env, exports);
   return exports;
 }
 
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// liboqs-cpp
+#include "oqs_cpp.h"
+#include "common.h"
+
+#include "Algorithms.h"
+#include "Random.h"
+#include "SecureArena.h"
+#include "Stats.h"
+
+/**
+ * Span-based counterparts of the liboqs-cpp KeyEncapsulation and Signature classes.
+ * Inputs are passed to the liboqs C API straight from caller-owned memory,
+ * rather than being copied into a byte vector first.
+ */
+namespace oqs_span {
+
+  using oqs::byte;
+  using oqs::bytes;
+
+  /**
+   * A read-only view of caller-owned memory. The memory must stay valid and unchanged for the duration of the call that it is passed to.
+   */
+  struct byte_span {
+    const byte* data;
+    std::size_t size;
+  };
+
+  class KeyEncapsulation {
+    public:
+      struct KeyEncapsulationDetails {
+        std::string name;
+        std::string version;
+        std::size_t claimed_nist_level;
+        bool is_ind_cca;
+        std::size_t length_public_key;
+        std::size_t length_secret_key;
+        std::size_t length_ciphertext;
+        std::size_t length_shared_secret;
+      };
+
+    private:
+      std::unique_ptr<OQS_KEM, decltype(&OQS_KEM_free)> kem_;
+      // Kept in the SecureArena, which locks it into RAM and cleanses it when it is replaced or the instance is destroyed
+      SecureArena::Block secret_key_;
+      KeyEncapsulationDetails details_;
+      Stats::AlgorithmStats* stats_;
+
+    public:
+      explicit KeyEncapsulation(const std::string& alg_name, byte_span secret_key = {nullptr, 0})
+        : kem_(nullptr, &OQS_KEM_free) {
+        // Throws if the algorithm is not supported or not enabled
+        Algorithms::findKEM(alg_name);
+        kem_.reset(OQS_KEM_new(alg_name.c_str()));
+        if (kem_ == nullptr) {
+          throw oqs::MechanismNotEnabledError(alg_name);
+        }
+        details_ = {
+          kem_->method_name,
+          kem_->alg_version,
+          kem_->claimed_nist_level,
+          kem_->ind_cca,
+          kem_->length_public_key,
+          kem_->length_secret_key,
+          kem_->length_ciphertext,
+          kem_->length_shared_secret
+        };
+        stats_ = &Stats::forAlgorithm(details_.name);
+        if (secret_key.size > 0) {
+          secret_key_ = SecureArena::Block(secret_key.size);
+          std::copy(secret_key.data, secret_key.data + secret_key.size, secret_key_.data());
+        }
+      }
+
+      KeyEncapsulation(const KeyEncapsulation&) = delete;
+      KeyEncapsulation& operator=(const KeyEncapsulation&) = delete;
+
+      const KeyEncapsulationDetails& get_details() const {
+        return details_;
+      }
+
+      /**
+       * Generates a keypair, keeping the secret key and writing the public key into caller-owned memory,
+       * which must have room for length_public_key bytes.
+       */
+      void generate_keypair(byte* public_key) {
+        Stats::Timer timer(*stats_, Stats::Operation::GenerateKeypair, 0);
+        secret_key_.reset();
+        SecureArena::Block secret_key(details_.length_secret_key);
+        Random::Guard guard;
+        if (OQS_KEM_keypair(kem_.get(), public_key, secret_key.data()) != OQS_SUCCESS) {
+          throw std::runtime_error("Can not generate keypair");
+        }
+        secret_key_ = std::move(secret_key);
+        timer.succeed(details_.length_public_key + secret_key_.size());
+      }
+
+      /**
+       * Generates a keypair directly into caller-owned memory, which must have room for
+       * length_public_key and length_secret_key bytes respectively.
+       * The instance's own secret key is left untouched.
+       */
+      void generate_keypair(byte* public_key, byte* secret_key) const {
+        Stats::Timer timer(*stats_, Stats::Operation::GenerateKeypair, 0);
+        Random::Guard guard;
+        if (OQS_KEM_keypair(kem_.get(), public_key, secret_key) != OQS_SUCCESS) {
+          OQS_MEM_cleanse(secret_key, details_.length_secret_key);
+          throw std::runtime_error("Can not generate keypair");
+        }
+        timer.succeed(details_.length_public_key + details_.length_secret_key);
+      }
+
+      /**
+       * Replaces the secret key with one already in the SecureArena, without copying it.
+       */
+      void set_secret_key(SecureArena::Block&& secret_key) {
+        secret_key_ = std::move(secret_key);
+      }
+
+      /**
+       * A view of the secret key, valid until the key is next changed.
+       */
+      byte_span secret_key() const {
+        return {secret_key_.data(), secret_key_.size()};
+      }
+
+      /**
+       * Encapsulates directly into caller-owned memory, which must have room for
+       * length_ciphertext and length_shared_secret bytes respectively.
+       */
+      void encap_secret(byte_span public_key, byte* ciphertext, byte* shared_secret) const {
+        Stats::Timer timer(*stats_, Stats::Operation::EncapsulateSecret, public_key.size);
+        if (public_key.size != details_.length_public_key) {
+          throw std::runtime_error("Incorrect public key length");
+        }
+        Random::Guard guard;
+        if (OQS_KEM_encaps(kem_.get(), ciphertext, shared_secret, public_key.data) != OQS_SUCCESS) {
+          OQS_MEM_cleanse(shared_secret, details_.length_shared_secret);
+          throw std::runtime_error("Can not encapsulate secret");
+        }
+        timer.succeed(details_.length_ciphertext + details_.length_shared_secret);
+      }
+
+      /**
+       * Decapsulates directly into caller-owned memory, which must have room for length_shared_secret bytes.
+       */
+      void decap_secret(byte_span ciphertext, byte* shared_secret) const {
+        Stats::Timer timer(*stats_, Stats::Operation::DecapsulateSecret, ciphertext.size);
+        if (ciphertext.size != details_.length_ciphertext) {
+          throw std::runtime_error("Incorrect ciphertext length");
+        }
+        if (secret_key_.size() != details_.length_secret_key) {
+          throw std::runtime_error(
+            "Incorrect secret key length, make sure you specify one in the constructor or run generate_keypair()"
+          );
+        }
+        if (OQS_KEM_decaps(kem_.get(), shared_secret, ciphertext.data, secret_key_.data()) != OQS_SUCCESS) {
+          throw std::runtime_error("Can not decapsulate secret");
+        }
+        timer.succeed(details_.length_shared_secret);
+      }
+  };
+
+  class Signature {
+    public:
+      struct SignatureDetails {
+        std::string name;
+        std::string version;
+        std::size_t claimed_nist_level;
+        bool is_euf_cma;
+        std::size_t length_public_key;
+        std::size_t length_secret_key;
+        std::size_t max_length_signature;
+      };
+
+    private:
+      std::unique_ptr<OQS_SIG, decltype(&OQS_SIG_free)> sig_;
+      // Kept in the SecureArena, which locks it into RAM and cleanses it when it is replaced or the instance is destroyed
+      SecureArena::Block secret_key_;
+      SignatureDetails details_;
+      Stats::AlgorithmStats* stats_;
+
+    public:
+      explicit Signature(const std::string& alg_name, byte_span secret_key = {nullptr, 0})
+        : sig_(nullptr, &OQS_SIG_free) {
+        // Throws if the algorithm is not supported or not enabled
+        Algorithms::findSig(alg_name);
+        sig_.reset(OQS_SIG_new(alg_name.c_str()));
+        if (sig_ == nullptr) {
+          throw oqs::MechanismNotEnabledError(alg_name);
+        }
+        details_ = {
+          sig_->method_name,
+          sig_->alg_version,
+          sig_->claimed_nist_level,
+          sig_->euf_cma,
+          sig_->length_public_key,
+          sig_->length_secret_key,
+          sig_->length_signature
+        };
+        stats_ = &Stats::forAlgorithm(details_.name);
+        if (secret_key.size > 0) {
+          secret_key_ = SecureArena::Block(secret_key.size);
+          std::copy(secret_key.data, secret_key.data + secret_key.size, secret_key_.data());
+        }
+      }
+
+      Signature(const Signature&) = delete;
+      Signature& operator=(const Signature&) = delete;
+
+      const SignatureDetails& get_details() const {
+        return details_;
+      }
+
+      /**
+       * Generates a keypair, keeping the secret key and writing the public key into caller-owned memory,
+       * which must have room for length_public_key bytes.
+       */
+      void generate_keypair(byte* public_key) {
+        Stats::Timer timer(*stats_, Stats::Operation::GenerateKeypair, 0);
+        secret_key_.reset();
+        SecureArena::Block secret_key(details_.length_secret_key);
+        Random::Guard guard;
+        if (OQS_SIG_keypair(sig_.get(), public_key, secret_key.data()) != OQS_SUCCESS) {
+          throw std::runtime_error("Can not generate keypair");
+        }
+        secret_key_ = std::move(secret_key);
+        timer.succeed(details_.length_public_key + secret_key_.size());
+      }
+
+      /**
+       * Generates a keypair directly into caller-owned memory, which must have room for
+       * length_public_key and length_secret_key bytes respectively.
+       * The instance's own secret key is left untouched.
+       */
+      void generate_keypair(byte* public_key, byte* secret_key) const {
+        Stats::Timer timer(*stats_, Stats::Operation::GenerateKeypair, 0);
+        Random::Guard guard;
+        if (OQS_SIG_keypair(sig_.get(), public_key, secret_key) != OQS_SUCCESS) {
+          OQS_MEM_cleanse(secret_key, details_.length_secret_key);
+          throw std::runtime_error("Can not generate keypair");
+        }
+        timer.succeed(details_.length_public_key + details_.length_secret_key);
+      }
+
+      /**
+       * A view of the secret key, valid until the key is next changed.
+       */
+      byte_span secret_key() const {
+        return {secret_key_.data(), secret_key_.size()};
+      }
+
+      bytes sign(byte_span message) const {
+        bytes signature(details_.max_length_signature, 0);
+        signature.resize(sign(message, signature.data()));
+        return signature;
+      }
+
+      /**
+       * Signs directly into caller-owned memory, which must have room for max_length_signature bytes.
+       * Returns the length of the signature.
+       */
+      std::size_t sign(byte_span message, byte* signature) const {
+        Stats::Timer timer(*stats_, Stats::Operation::Sign, message.size);
+        if (secret_key_.size() != details_.length_secret_key) {
+          throw std::runtime_error(
+            "Incorrect secret key length, make sure you specify one in the constructor or run generate_keypair()"
+          );
+        }
+        std::size_t signature_length = 0;
+        Random::Guard guard;
+        if (OQS_SIG_sign(sig_.get(), signature, &signature_length, message.data, message.size, secret_key_.data()) != OQS_SUCCESS) {
+          throw std::runtime_error("Can not sign message");
+        }
+        timer.succeed(signature_length);
+        return signature_length;
+      }
+
+      bool verify(byte_span message, byte_span signature, byte_span public_key) const {
+        Stats::Timer timer(*stats_, Stats::Operation::Verify, message.size + signature.size + public_key.size);
+        if (public_key.size != details_.length_public_key) {
+          throw std::runtime_error("Incorrect public key length");
+        }
+        if (signature.size > details_.max_length_signature) {
+          throw std::runtime_error("Incorrect signature size");
+        }
+        const bool valid = OQS_SIG_verify(sig_.get(), message.data, message.size, signature.data, signature.size, public_key.data) == OQS_SUCCESS;
+        timer.succeed(0);
+        return valid;
+      }
+  };
+
+} // namespace oqs_span
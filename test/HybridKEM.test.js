@@ -0,0 +1,124 @@
+const {expect} = require("chai")
+  .use(require("chai-bytes"));
+
+const {
+  HybridKEM,
+  KEMs
+} = require("../lib/index.js");
+
+describe("HybridKEM", () => {
+  const algorithm = KEMs.getEnabledAlgorithms()[0];
+
+  describe("constructor", () => {
+    it("should be constructible", () => {
+      expect(() => new HybridKEM(algorithm)).to.not.throw();
+    });
+    it("should accept an exported secret key", () => {
+      const original = new HybridKEM(algorithm);
+      original.generateKeypair();
+      const secretKey = original.exportSecretKey();
+      const restored = new HybridKEM(algorithm, secretKey);
+      expect(restored.exportSecretKey()).to.equalBytes(secretKey);
+    });
+    it("should throw when called with an invalid algorithm", () => {
+      expect(() => new HybridKEM("invalid algorithm")).to.throw();
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => new HybridKEM(123)).to.throw();
+      expect(() => new HybridKEM(algorithm, "invalid secret key")).to.throw();
+    });
+    it("should throw when called with a secret key of the wrong length", () => {
+      expect(() => new HybridKEM(algorithm, Buffer.alloc(48))).to.throw();
+    });
+  });
+
+  describe("#getDetails", () => {
+    it("should return the lengths of the hybrid values", () => {
+      const hybridKEM = new HybridKEM(algorithm);
+      const details = hybridKEM.getDetails();
+      expect(details.name).to.equal(`X25519+${details.kem.name}`);
+      expect(details.publicKeyLength).to.equal(32 + details.kem.publicKeyLength);
+      expect(details.secretKeyLength).to.equal(32 + details.kem.secretKeyLength);
+      expect(details.ciphertextLength).to.equal(32 + details.kem.ciphertextLength);
+      expect(details.sharedSecretLength).to.equal(32);
+    });
+  });
+
+  describe("#generateKeypair", () => {
+    it("should return a public key with the correct length", () => {
+      const hybridKEM = new HybridKEM(algorithm);
+      const publicKey = hybridKEM.generateKeypair();
+      expect(publicKey).to.be.an.instanceof(Buffer);
+      expect(publicKey.length).to.equal(hybridKEM.getDetails().publicKeyLength);
+      expect(hybridKEM.exportSecretKey().length).to.equal(hybridKEM.getDetails().secretKeyLength);
+    });
+  });
+
+  describe("#encapsulateSecret and #decapsulateSecret", () => {
+    it("should agree on the shared secret", () => {
+      const recipient = new HybridKEM(algorithm);
+      const sender = new HybridKEM(algorithm);
+      const publicKey = recipient.generateKeypair();
+      const {ciphertext, sharedSecret} = sender.encapsulateSecret(publicKey);
+      expect(ciphertext.length).to.equal(recipient.getDetails().ciphertextLength);
+      expect(sharedSecret.length).to.equal(32);
+      expect(recipient.decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+    });
+    it("should agree after the secret key is restored", () => {
+      const recipient = new HybridKEM(algorithm);
+      const publicKey = recipient.generateKeypair();
+      const restored = new HybridKEM(algorithm, recipient.exportSecretKey());
+      const {ciphertext, sharedSecret} = new HybridKEM(algorithm).encapsulateSecret(publicKey);
+      expect(restored.decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+    });
+    it("should not agree when the X25519 part of the ciphertext is altered", () => {
+      const recipient = new HybridKEM(algorithm);
+      const publicKey = recipient.generateKeypair();
+      const {ciphertext, sharedSecret} = new HybridKEM(algorithm).encapsulateSecret(publicKey);
+      const altered = Buffer.from(ciphertext);
+      altered[0] ^= 1;
+      let decapsulated;
+      try {
+        decapsulated = recipient.decapsulateSecret(altered);
+      } catch (err) {
+        return;
+      }
+      expect(decapsulated).to.not.equalBytes(sharedSecret);
+    });
+    it("should throw when decapsulating without a secret key", () => {
+      const recipient = new HybridKEM(algorithm);
+      const publicKey = new HybridKEM(algorithm).generateKeypair();
+      const {ciphertext} = recipient.encapsulateSecret(publicKey);
+      expect(() => recipient.decapsulateSecret(ciphertext)).to.throw();
+    });
+    it("should throw when called with invalid arguments", () => {
+      const hybridKEM = new HybridKEM(algorithm);
+      hybridKEM.generateKeypair();
+      expect(() => hybridKEM.encapsulateSecret("invalid type")).to.throw();
+      expect(() => hybridKEM.encapsulateSecret(Buffer.alloc(10))).to.throw();
+      expect(() => hybridKEM.decapsulateSecret("invalid type")).to.throw();
+      expect(() => hybridKEM.decapsulateSecret(Buffer.alloc(10))).to.throw();
+    });
+  });
+
+  describe("async methods", () => {
+    it("should agree on the shared secret", async () => {
+      const recipient = new HybridKEM(algorithm);
+      const sender = new HybridKEM(algorithm);
+      const publicKey = await recipient.generateKeypairAsync();
+      const {ciphertext, sharedSecret} = await sender.encapsulateSecretAsync(publicKey);
+      expect(await recipient.decapsulateSecretAsync(ciphertext)).to.equalBytes(sharedSecret);
+    });
+    it("should reject when decapsulating a ciphertext of the wrong length", async () => {
+      const recipient = new HybridKEM(algorithm);
+      await recipient.generateKeypairAsync();
+      let error;
+      try {
+        await recipient.decapsulateSecretAsync(Buffer.alloc(10));
+      } catch (err) {
+        error = err;
+      }
+      expect(error).to.be.an.instanceof(Error);
+    });
+  });
+});
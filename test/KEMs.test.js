@@ -1,7 +1,10 @@
 const {expect} = require("chai")
   .use(require("chai-bytes"));
 
-const {KEMs} = require("../lib/index.js");
+const {
+  KeyEncapsulation,
+  KEMs
+} = require("../lib/index.js");
 
 describe("KEMs", () => {
   describe("static #getEnabledAlgorithms", () => {
@@ -22,6 +25,11 @@ describe("KEMs", () => {
     it("should not throw", () => {
       expect(() => KEMs.getEnabledAlgorithms()).to.not.throw();
     });
+    it("should return the same frozen array every time", () => {
+      const output = KEMs.getEnabledAlgorithms();
+      expect(output).to.be.frozen;
+      expect(KEMs.getEnabledAlgorithms()).to.equal(output);
+    });
   });
 
   describe("static #isAlgorithmEnabled", () => {
@@ -39,4 +47,30 @@ describe("KEMs", () => {
       expect(() => KEMs.isAlgorithmEnabled()).to.throw();
     });
   });
+
+  describe("static #getDetails", () => {
+    it("should return the same details as an instance", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      for (const algorithm of algorithms) {
+        const instance = new KeyEncapsulation(algorithm);
+        expect(KEMs.getDetails(algorithm)).to.deep.equal(instance.getDetails());
+      }
+    });
+    it("should return the same frozen object every time", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const output = KEMs.getDetails(algorithms[0]);
+      expect(output).to.be.frozen;
+      expect(KEMs.getDetails(algorithms[0])).to.equal(output);
+      expect(new KeyEncapsulation(algorithms[0]).getDetails()).to.equal(output);
+    });
+    it("should throw when called with an invalid algorithm", () => {
+      expect(() => KEMs.getDetails("invalid algorithm")).to.throw();
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => KEMs.getDetails(123)).to.throw();
+    });
+    it("should throw when called without arguments", () => {
+      expect(() => KEMs.getDetails()).to.throw();
+    });
+  });
 });
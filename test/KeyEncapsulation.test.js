@@ -102,6 +102,22 @@ describe("KeyEncapsulation", () => {
       const keyEncapsulation = new KeyEncapsulation(algorithms[0], secretKey);
       expect(() => keyEncapsulation.exportSecretKey()).to.not.throw();
     });
+    it("should not be affected by changes to the Buffer passed to the constructor", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const secretKey = Buffer.alloc(48, "TCosmo");
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0], secretKey);
+      const expected = Buffer.from(secretKey);
+      secretKey.fill(0);
+      expect(keyEncapsulation.exportSecretKey()).to.equalBytes(expected);
+    });
+    it("should export the secret key of the latest keypair", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      keyEncapsulation.generateKeypair();
+      const firstSecretKey = keyEncapsulation.exportSecretKey();
+      keyEncapsulation.generateKeypair();
+      expect(keyEncapsulation.exportSecretKey()).to.not.equalBytes(firstSecretKey);
+    });
   });
 
   describe("#encapsulateSecret", () => {
@@ -222,6 +238,198 @@ describe("KeyEncapsulation", () => {
     });
   });
 
+  describe("#generateKeypairAsync", () => {
+    it("should return a Promise", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const output = keyEncapsulation.generateKeypairAsync();
+      expect(output).to.be.an.instanceof(Promise);
+      await output;
+    });
+    it("should resolve to a Buffer with the correct length", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const algorithmDetails = keyEncapsulation.getDetails();
+      const publicKey = await keyEncapsulation.generateKeypairAsync();
+      expect(publicKey).to.be.an.instanceof(Buffer);
+      expect(publicKey.length).to.equal(algorithmDetails.publicKeyLength);
+    });
+  });
+
+  describe("#encapsulateSecretAsync", () => {
+    it("should resolve to an object with ciphertext and shared secret buffers", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const algorithmDetails = keyEncapsulation.getDetails();
+      const publicKey = keyEncapsulation.generateKeypair();
+      const output = await keyEncapsulation.encapsulateSecretAsync(publicKey);
+      expect(output.ciphertext).to.be.an.instanceof(Buffer);
+      expect(output.sharedSecret).to.be.an.instanceof(Buffer);
+      expect(output.ciphertext.length).to.equal(algorithmDetails.ciphertextLength);
+      expect(output.sharedSecret.length).to.equal(algorithmDetails.sharedSecretLength);
+    });
+    it("should reject when called with an invalid public key", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const algorithmDetails = keyEncapsulation.getDetails();
+      const badPublicKey = Buffer.alloc(algorithmDetails.publicKeyLength + 1, "TCosmo");
+      let error = null;
+      try {
+        await keyEncapsulation.encapsulateSecretAsync(badPublicKey);
+      } catch (e) {
+        error = e;
+      }
+      expect(error).to.be.an.instanceof(Error);
+    });
+    it("should throw when called with an invalid type", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      expect(() => keyEncapsulation.encapsulateSecretAsync("invalid type")).to.throw();
+      expect(() => keyEncapsulation.encapsulateSecretAsync()).to.throw();
+    });
+  });
+
+  describe("#decapsulateSecretAsync", () => {
+    it("should resolve to the shared secret", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const publicKey = await keyEncapsulation.generateKeypairAsync();
+      const {ciphertext, sharedSecret} = await keyEncapsulation.encapsulateSecretAsync(publicKey);
+      const output = await keyEncapsulation.decapsulateSecretAsync(ciphertext);
+      expect(output).to.equalBytes(sharedSecret);
+    });
+    it("should reject when called without a secret key having been generated", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const otherKeyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      const publicKey = otherKeyEncapsulation.generateKeypair();
+      const {ciphertext} = keyEncapsulation.encapsulateSecret(publicKey);
+      let error = null;
+      try {
+        await keyEncapsulation.decapsulateSecretAsync(ciphertext);
+      } catch (e) {
+        error = e;
+      }
+      expect(error).to.be.an.instanceof(Error);
+    });
+    it("should throw when called with an invalid type", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const keyEncapsulation = new KeyEncapsulation(algorithms[0]);
+      expect(() => keyEncapsulation.decapsulateSecretAsync("invalid type")).to.throw();
+      expect(() => keyEncapsulation.decapsulateSecretAsync()).to.throw();
+    });
+  });
+
+  describe("#encapsulateSecretMany", () => {
+    const algorithms = KEMs.getEnabledAlgorithms();
+    const recipients = [0, 1, 2].map(() => new KeyEncapsulation(algorithms[0]));
+    const publicKeys = recipients.map((recipient) => recipient.generateKeypair());
+    const sender = new KeyEncapsulation(algorithms[0]);
+    const algorithmDetails = sender.getDetails();
+
+    it("should return packed ciphertexts and shared secrets", () => {
+      const output = sender.encapsulateSecretMany(publicKeys);
+      expect(output.ciphertexts).to.be.an.instanceof(Buffer);
+      expect(output.sharedSecrets).to.be.an.instanceof(Buffer);
+      expect(output.ciphertextLength).to.equal(algorithmDetails.ciphertextLength);
+      expect(output.sharedSecretLength).to.equal(algorithmDetails.sharedSecretLength);
+      expect(output.ciphertexts.length).to.equal(publicKeys.length * algorithmDetails.ciphertextLength);
+      expect(output.sharedSecrets.length).to.equal(publicKeys.length * algorithmDetails.sharedSecretLength);
+    });
+    it("should produce shared secrets that each recipient can decapsulate", () => {
+      const {ciphertexts, sharedSecrets, ciphertextLength, sharedSecretLength} = sender.encapsulateSecretMany(publicKeys);
+      recipients.forEach((recipient, i) => {
+        const ciphertext = ciphertexts.subarray(i * ciphertextLength, (i + 1) * ciphertextLength);
+        const sharedSecret = sharedSecrets.subarray(i * sharedSecretLength, (i + 1) * sharedSecretLength);
+        expect(recipient.decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+      });
+    });
+    it("should resolve asynchronously", async () => {
+      const {ciphertexts, sharedSecrets, ciphertextLength, sharedSecretLength} = await sender.encapsulateSecretManyAsync(publicKeys);
+      const ciphertext = ciphertexts.subarray(ciphertextLength, 2 * ciphertextLength);
+      const sharedSecret = sharedSecrets.subarray(sharedSecretLength, 2 * sharedSecretLength);
+      expect(recipients[1].decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+    });
+    it("should throw when called with an invalid public key", () => {
+      const badPublicKey = Buffer.alloc(algorithmDetails.publicKeyLength + 1, "TCosmo");
+      expect(() => sender.encapsulateSecretMany([publicKeys[0], badPublicKey])).to.throw();
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => sender.encapsulateSecretMany()).to.throw();
+      expect(() => sender.encapsulateSecretMany(publicKeys[0])).to.throw();
+      expect(() => sender.encapsulateSecretMany(["invalid type"])).to.throw();
+    });
+  });
+
+  describe("static #generateKeypairs", () => {
+    it("should return packed keys with a fixed stride", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const details = KEMs.getDetails(algorithms[0]);
+      const batch = KeyEncapsulation.generateKeypairs(algorithms[0], 4);
+      expect(batch.count).to.equal(4);
+      expect(batch.publicKeyLength).to.equal(details.publicKeyLength);
+      expect(batch.secretKeyLength).to.equal(details.secretKeyLength);
+      expect(batch.publicKeys.length).to.equal(4 * details.publicKeyLength);
+      expect(batch.secretKeys.length).to.equal(4 * details.secretKeyLength);
+    });
+    it("should return usable keypairs", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const {publicKeys, secretKeys, publicKeyLength, secretKeyLength} = KeyEncapsulation.generateKeypairs(algorithms[0], 3);
+      for (let i = 0; i < 3; i++) {
+        const publicKey = publicKeys.subarray(i * publicKeyLength, (i + 1) * publicKeyLength);
+        const secretKey = secretKeys.subarray(i * secretKeyLength, (i + 1) * secretKeyLength);
+        const sender = new KeyEncapsulation(algorithms[0]);
+        const {ciphertext, sharedSecret} = sender.encapsulateSecret(publicKey);
+        const recipient = new KeyEncapsulation(algorithms[0], secretKey);
+        expect(recipient.decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+      }
+    });
+    it("should return usable keypairs from a batch larger than any arena slot", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const details = KEMs.getDetails(algorithms[0]);
+      const count = Math.ceil(32 * 1024 / details.secretKeyLength);
+      const {publicKeys, secretKeys, publicKeyLength, secretKeyLength} = KeyEncapsulation.generateKeypairs(algorithms[0], count);
+      expect(secretKeys.length).to.be.above(16 * 1024);
+      const publicKey = publicKeys.subarray((count - 1) * publicKeyLength);
+      const secretKey = secretKeys.subarray((count - 1) * secretKeyLength);
+      const {ciphertext, sharedSecret} = new KeyEncapsulation(algorithms[0]).encapsulateSecret(publicKey);
+      expect(new KeyEncapsulation(algorithms[0], secretKey).decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+    });
+    it("should generate distinct keypairs", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const {publicKeys, publicKeyLength} = KeyEncapsulation.generateKeypairs(algorithms[0], 2);
+      expect(publicKeys.subarray(0, publicKeyLength)).to.not.equalBytes(publicKeys.subarray(publicKeyLength));
+    });
+    it("should support a count of zero", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const batch = KeyEncapsulation.generateKeypairs(algorithms[0], 0);
+      expect(batch.publicKeys.length).to.equal(0);
+      expect(batch.secretKeys.length).to.equal(0);
+    });
+    it("should throw when called with invalid arguments", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      expect(() => KeyEncapsulation.generateKeypairs("invalid algorithm", 1)).to.throw();
+      expect(() => KeyEncapsulation.generateKeypairs(algorithms[0], -1)).to.throw();
+      expect(() => KeyEncapsulation.generateKeypairs(algorithms[0], 1.5)).to.throw();
+      expect(() => KeyEncapsulation.generateKeypairs(algorithms[0])).to.throw();
+    });
+  });
+
+  describe("static #generateKeypairsAsync", () => {
+    it("should resolve to usable packed keypairs", async () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      const {publicKeys, secretKeys, publicKeyLength, secretKeyLength, count} = await KeyEncapsulation.generateKeypairsAsync(algorithms[0], 8);
+      expect(count).to.equal(8);
+      const publicKey = publicKeys.subarray(7 * publicKeyLength);
+      const secretKey = secretKeys.subarray(7 * secretKeyLength);
+      const {ciphertext, sharedSecret} = new KeyEncapsulation(algorithms[0]).encapsulateSecret(publicKey);
+      expect(new KeyEncapsulation(algorithms[0], secretKey).decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+    });
+    it("should throw when called with an invalid algorithm", () => {
+      expect(() => KeyEncapsulation.generateKeypairsAsync("invalid algorithm", 1)).to.throw();
+    });
+  });
+
   describe("integration", () => {
     const algorithms = KEMs.getEnabledAlgorithms();
     const alice = new KeyEncapsulation(algorithms[0]);
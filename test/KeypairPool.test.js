@@ -0,0 +1,70 @@
+const {expect} = require("chai")
+  .use(require("chai-bytes"));
+
+const {
+  KEMs,
+  KeyEncapsulation,
+  KeypairPool
+} = require("../lib/index.js");
+
+const wait = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+describe("KeypairPool", () => {
+  const algorithms = KEMs.getEnabledAlgorithms();
+
+  describe("constructor", () => {
+    it("should be constructible", () => {
+      const pool = new KeypairPool(algorithms[0]);
+      pool.close();
+    });
+    it("should accept options", () => {
+      const pool = new KeypairPool(algorithms[0], {low: 1, high: 2});
+      pool.close();
+    });
+    it("should throw when called with an invalid algorithm", () => {
+      expect(() => new KeypairPool("invalid algorithm")).to.throw();
+    });
+    it("should throw when low is greater than high", () => {
+      expect(() => new KeypairPool(algorithms[0], {low: 3, high: 2})).to.throw(TypeError);
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => new KeypairPool(algorithms[0], {low: "1"})).to.throw(TypeError);
+    });
+  });
+
+  describe("#take", () => {
+    it("should return a working keypair", () => {
+      const pool = new KeypairPool(algorithms[0], {low: 1, high: 2});
+      const {publicKey, keyEncapsulation} = pool.take();
+      expect(keyEncapsulation).to.be.an.instanceof(KeyEncapsulation);
+      const sender = new KeyEncapsulation(algorithms[0]);
+      const {ciphertext, sharedSecret} = sender.encapsulateSecret(publicKey);
+      expect(keyEncapsulation.decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+      pool.close();
+    });
+    it("should return different keypairs", () => {
+      const pool = new KeypairPool(algorithms[0], {low: 1, high: 2});
+      const first = pool.take();
+      const second = pool.take();
+      expect(first.publicKey).to.not.equalBytes(second.publicKey);
+      pool.close();
+    });
+    it("should throw after the pool has been closed", () => {
+      const pool = new KeypairPool(algorithms[0]);
+      pool.close();
+      expect(() => pool.take()).to.throw();
+    });
+  });
+
+  describe("#getSize", () => {
+    it("should fill up in the background", async () => {
+      const pool = new KeypairPool(algorithms[0], {low: 1, high: 3});
+      for (let i = 0; i < 100 && pool.getSize() < 3; i++) {
+        await wait(10);
+      }
+      expect(pool.getSize()).to.equal(3);
+      pool.close();
+      expect(pool.getSize()).to.equal(0);
+    });
+  });
+});
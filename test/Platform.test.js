@@ -0,0 +1,66 @@
+const {expect} = require("chai");
+
+const {
+  KEMs,
+  Platform,
+  Sigs
+} = require("../lib/index.js");
+
+describe("Platform", () => {
+  describe("static #getCpuFeatures", () => {
+    it("should return a boolean for every feature", () => {
+      const features = Platform.getCpuFeatures();
+      expect(features).to.include.all.keys("AES", "AVX2", "BMI2", "POPCNT", "ARM_NEON");
+      for (const value of Object.values(features)) {
+        expect(value).to.be.a("boolean");
+      }
+    });
+  });
+
+  describe("static #getImplementation", () => {
+    it("should describe every enabled algorithm", () => {
+      for (const algorithm of [...KEMs.getEnabledAlgorithms(), ...Sigs.getEnabledAlgorithms()]) {
+        const output = Platform.getImplementation(algorithm);
+        expect(output.algorithm).to.equal(algorithm);
+        expect(output.implementation).to.be.a("string");
+        expect(output.candidates).to.be.an("array");
+      }
+    });
+    it("should only select a candidate that the CPU supports", () => {
+      const features = Platform.getCpuFeatures();
+      for (const algorithm of [...KEMs.getEnabledAlgorithms(), ...Sigs.getEnabledAlgorithms()]) {
+        const {implementation, candidates} = Platform.getImplementation(algorithm);
+        const supported = candidates.filter((candidate) => candidate.supported);
+        if (supported.length === 0) {
+          expect(implementation).to.equal("reference");
+        } else {
+          expect(implementation).to.equal(supported[0].implementation);
+          for (const feature of supported[0].cpuFeatures) {
+            expect(features[feature]).to.be.true;
+          }
+        }
+      }
+    });
+    it("should throw when called with an invalid algorithm", () => {
+      expect(() => Platform.getImplementation("invalid algorithm")).to.throw();
+      expect(() => Platform.getImplementation(123)).to.throw();
+      expect(() => Platform.getImplementation()).to.throw();
+    });
+  });
+
+  describe("static #getBuildInfo", () => {
+    it("should describe the build", () => {
+      const build = Platform.getBuildInfo();
+      expect(build.liboqsVersion).to.be.a("string");
+      expect(build.distBuild).to.be.a("boolean");
+      expect(build.hostTuned).to.be.a("boolean");
+    });
+    it("should count the enabled algorithms", () => {
+      const build = Platform.getBuildInfo();
+      expect(build.enabledKEMCount).to.equal(KEMs.getEnabledAlgorithms().length);
+      expect(build.enabledSigCount).to.equal(Sigs.getEnabledAlgorithms().length);
+      expect(build.supportedKEMCount).to.be.at.least(build.enabledKEMCount);
+      expect(build.supportedSigCount).to.be.at.least(build.enabledSigCount);
+    });
+  });
+});
@@ -15,6 +15,18 @@ describe("Random", () => {
     it("should throw when called with an invalid algorithm string", () => {
       expect(() => Random.switchAlgorithm("invalid algorithm")).to.throw();
     });
+    it("should select the SHAKE256 DRBG", () => {
+      Random.switchAlgorithm("SHAKE256-DRBG");
+      try {
+        const first = Random.randomBytes(64);
+        const second = Random.randomBytes(64);
+        const large = Random.randomBytes(100000);
+        expect(first).to.not.equalBytes(second);
+        expect(large).to.not.equalBytes(Buffer.alloc(large.length));
+      } finally {
+        Random.switchAlgorithm("system");
+      }
+    });
     it("should throw when called with an invalid type", () => {
       expect(() => Random.switchAlgorithm(123)).to.throw();
     });
@@ -40,6 +52,19 @@ describe("Random", () => {
       expect(randomBytes100.length).to.equal(100);
       expect(randomBytes273.length).to.equal(273);
     });
+    it("should return distinct Buffers when many are alive at once", () => {
+      const buffers = Array.from({length: 5000}, () => Random.randomBytes(32));
+      const distinct = new Set(buffers.map((buffer) => buffer.toString("hex")));
+      expect(distinct.size).to.equal(buffers.length);
+    });
+    it("should support sizes larger than a secure memory slot", () => {
+      const randomBytes = Random.randomBytes(100000);
+      expect(randomBytes.length).to.equal(100000);
+      expect(randomBytes).to.not.equalBytes(Buffer.alloc(100000));
+    });
+    it("should support a size of zero", () => {
+      expect(Random.randomBytes(0).length).to.equal(0);
+    });
     it("should throw when called with an invalid type", () => {
       expect(() => Random.randomBytes("invalid type")).to.throw();
     });
@@ -51,6 +76,101 @@ describe("Random", () => {
     });
   });
 
+  describe("static #randomFill", () => {
+    it("should return the buffer that was passed in", () => {
+      const buffer = Buffer.alloc(100);
+      expect(Random.randomFill(buffer)).to.equal(buffer);
+      expect(buffer).to.not.equalBytes(Buffer.alloc(100));
+    });
+    it("should only fill the requested region", () => {
+      const buffer = Buffer.alloc(100);
+      Random.randomFill(buffer, 10, 50);
+      expect(buffer.subarray(0, 10)).to.equalBytes(Buffer.alloc(10));
+      expect(buffer.subarray(10, 60)).to.not.equalBytes(Buffer.alloc(50));
+      expect(buffer.subarray(60)).to.equalBytes(Buffer.alloc(40));
+    });
+    it("should fill the rest of the buffer when no size is given", () => {
+      const buffer = Buffer.alloc(100);
+      Random.randomFill(buffer, 68);
+      expect(buffer.subarray(0, 68)).to.equalBytes(Buffer.alloc(68));
+      expect(buffer.subarray(68)).to.not.equalBytes(Buffer.alloc(32));
+    });
+    it("should use byte offsets for TypedArrays", () => {
+      const array = new Uint32Array(16);
+      Random.randomFill(array, 4, 8);
+      const bytes = Buffer.from(array.buffer);
+      expect(bytes.subarray(0, 4)).to.equalBytes(Buffer.alloc(4));
+      expect(bytes.subarray(4, 12)).to.not.equalBytes(Buffer.alloc(8));
+      expect(bytes.subarray(12)).to.equalBytes(Buffer.alloc(52));
+    });
+    it("should respect the offset of a view into a larger buffer", () => {
+      const backing = Buffer.alloc(96);
+      Random.randomFill(backing.subarray(32, 64));
+      expect(backing.subarray(0, 32)).to.equalBytes(Buffer.alloc(32));
+      expect(backing.subarray(32, 64)).to.not.equalBytes(Buffer.alloc(32));
+      expect(backing.subarray(64)).to.equalBytes(Buffer.alloc(32));
+    });
+    it("should support ArrayBuffers, DataViews and SharedArrayBuffers", () => {
+      const arrayBuffer = new ArrayBuffer(64);
+      Random.randomFill(arrayBuffer);
+      expect(Buffer.from(arrayBuffer)).to.not.equalBytes(Buffer.alloc(64));
+      const dataView = new DataView(new ArrayBuffer(64));
+      Random.randomFill(dataView);
+      expect(Buffer.from(dataView.buffer)).to.not.equalBytes(Buffer.alloc(64));
+      const shared = new Uint8Array(new SharedArrayBuffer(64));
+      Random.randomFill(shared);
+      expect(Buffer.from(shared)).to.not.equalBytes(Buffer.alloc(64));
+    });
+    it("should support a size of zero", () => {
+      const buffer = Buffer.alloc(10);
+      Random.randomFill(buffer, 10, 0);
+      expect(buffer).to.equalBytes(Buffer.alloc(10));
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => Random.randomFill("invalid type")).to.throw();
+      expect(() => Random.randomFill(Buffer.alloc(10), "invalid type")).to.throw();
+      expect(() => Random.randomFill(Buffer.alloc(10), 0, "invalid type")).to.throw();
+    });
+    it("should throw when the region does not fit in the buffer", () => {
+      const buffer = Buffer.alloc(10);
+      expect(() => Random.randomFill(buffer, 11)).to.throw();
+      expect(() => Random.randomFill(buffer, 5, 6)).to.throw();
+      expect(() => Random.randomFill(buffer, -1)).to.throw();
+      expect(() => Random.randomFill(buffer, 1.5)).to.throw();
+    });
+    it("should throw when called without arguments", () => {
+      expect(() => Random.randomFill()).to.throw();
+    });
+  });
+
+  describe("static #randomFillAsync", () => {
+    it("should resolve to the buffer that was passed in", async () => {
+      const small = Buffer.alloc(100);
+      const large = Buffer.alloc(100000);
+      expect(await Random.randomFillAsync(small)).to.equal(small);
+      expect(await Random.randomFillAsync(large)).to.equal(large);
+      expect(small).to.not.equalBytes(Buffer.alloc(100));
+      expect(large).to.not.equalBytes(Buffer.alloc(100000));
+    });
+    it("should only fill the requested region", async () => {
+      const buffer = Buffer.alloc(100000);
+      await Random.randomFillAsync(buffer, 1000, 50000);
+      expect(buffer.subarray(0, 1000)).to.equalBytes(Buffer.alloc(1000));
+      expect(buffer.subarray(1000, 51000)).to.not.equalBytes(Buffer.alloc(50000));
+      expect(buffer.subarray(51000)).to.equalBytes(Buffer.alloc(49000));
+    });
+    it("should support SharedArrayBuffers", async () => {
+      const shared = new Uint8Array(new SharedArrayBuffer(100000));
+      await Random.randomFillAsync(shared);
+      expect(Buffer.from(shared)).to.not.equalBytes(Buffer.alloc(100000));
+    });
+    it("should throw when called with invalid arguments", () => {
+      expect(() => Random.randomFillAsync("invalid type")).to.throw();
+      expect(() => Random.randomFillAsync(Buffer.alloc(10), 11)).to.throw();
+      expect(() => Random.randomFillAsync()).to.throw();
+    });
+  });
+
   describe("static #initNistKat", () => {
     it("should not return anything", () => {
       const entropy = Buffer.alloc(48, "entropy");
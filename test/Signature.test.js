@@ -1,3 +1,6 @@
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
 const {expect} = require("chai")
   .use(require("chai-bytes"));
 
@@ -131,6 +134,21 @@ describe("Signature", () => {
       const output = signature.sign(message);
       expect(output.length).to.be.at.most(algorithmDetails.maxSignatureLength);
     });
+    it("should return independent Buffers when called repeatedly", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const publicKey = signature.generateKeypair();
+      const messages = [];
+      const signatures = [];
+      for (let i = 0; i < 200; i++) {
+        const message = Buffer.alloc(48, `TCosmo${i}`);
+        messages.push(message);
+        signatures.push(signature.sign(message));
+      }
+      for (let i = 0; i < signatures.length; i++) {
+        expect(signature.verify(messages[i], signatures[i], publicKey)).to.be.true;
+      }
+    });
     it("should throw when called without a secret key having been generated", () => {
       const algorithms = Sigs.getEnabledAlgorithms();
       const signature = new Signature(algorithms[0]);
@@ -191,6 +209,310 @@ describe("Signature", () => {
     });
   });
 
+  describe("#generateKeypairAsync", () => {
+    it("should resolve to a Buffer with the correct length", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const algorithmDetails = signature.getDetails();
+      const output = signature.generateKeypairAsync();
+      expect(output).to.be.an.instanceof(Promise);
+      const publicKey = await output;
+      expect(publicKey).to.be.an.instanceof(Buffer);
+      expect(publicKey.length).to.equal(algorithmDetails.publicKeyLength);
+    });
+  });
+
+  describe("#signAsync", () => {
+    it("should resolve to a Buffer with the correct length", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const algorithmDetails = signature.getDetails();
+      await signature.generateKeypairAsync();
+      const message = Buffer.alloc(48, "TCosmo");
+      const output = await signature.signAsync(message);
+      expect(output).to.be.an.instanceof(Buffer);
+      expect(output.length).to.be.at.most(algorithmDetails.maxSignatureLength);
+    });
+    it("should reject when called without a secret key having been generated", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const message = Buffer.alloc(48, "TCosmo");
+      let error = null;
+      try {
+        await signature.signAsync(message);
+      } catch (e) {
+        error = e;
+      }
+      expect(error).to.be.an.instanceof(Error);
+    });
+    it("should throw when called with an invalid type", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      expect(() => signature.signAsync("invalid type")).to.throw();
+      expect(() => signature.signAsync()).to.throw();
+    });
+  });
+
+  describe("#verifyAsync", () => {
+    it("should verify correctly", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const publicKey = await signature.generateKeypairAsync();
+      const badSignature = new Signature(algorithms[0]);
+      const badPublicKey = await badSignature.generateKeypairAsync();
+      const message = Buffer.alloc(48, "TCosmo");
+      const sig = await signature.signAsync(message);
+      expect(await signature.verifyAsync(message, sig, publicKey)).to.be.true;
+      expect(await signature.verifyAsync(message, sig, badPublicKey)).to.be.false;
+    });
+    it("should throw when called with invalid types", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const message = Buffer.alloc(48, "TCosmo");
+      expect(() => signature.verifyAsync()).to.throw();
+      expect(() => signature.verifyAsync(message, "invalid type", message)).to.throw();
+    });
+  });
+
+  describe("#verifyBatch", () => {
+    const algorithms = Sigs.getEnabledAlgorithms();
+    const signature = new Signature(algorithms[0]);
+    const publicKey = signature.generateKeypair();
+    const otherSignature = new Signature(algorithms[0]);
+    const otherPublicKey = otherSignature.generateKeypair();
+    const messages = [0, 1, 2, 3].map((i) => Buffer.alloc(48, `TCosmo${i}`));
+    const signatures = messages.map((message) => signature.sign(message));
+
+    it("should return an array of booleans", () => {
+      const output = signature.verifyBatch(messages, signatures, publicKey);
+      expect(output).to.be.an("array").with.lengthOf(messages.length);
+      expect(output).to.deep.equal([true, true, true, true]);
+    });
+    it("should verify each item against its own public key", () => {
+      const publicKeys = [publicKey, otherPublicKey, publicKey, otherPublicKey];
+      const output = signature.verifyBatch(messages, signatures, publicKeys);
+      expect(output).to.deep.equal([true, false, true, false]);
+    });
+    it("should report malformed items as invalid", () => {
+      const badSignatures = [...signatures];
+      badSignatures[2] = Buffer.alloc(0);
+      const output = signature.verifyBatch(messages, badSignatures, publicKey);
+      expect(output).to.deep.equal([true, true, false, true]);
+    });
+    it("should return an empty array for an empty batch", () => {
+      expect(signature.verifyBatch([], [], [])).to.deep.equal([]);
+    });
+    it("should throw when called with mismatched lengths", () => {
+      expect(() => signature.verifyBatch(messages, signatures.slice(1), publicKey)).to.throw();
+      expect(() => signature.verifyBatch(messages, signatures, [publicKey])).to.throw();
+    });
+    it("should throw when called with invalid types", () => {
+      expect(() => signature.verifyBatch()).to.throw();
+      expect(() => signature.verifyBatch(messages, signatures, "invalid type")).to.throw();
+      expect(() => signature.verifyBatch(["invalid type"], [signatures[0]], publicKey)).to.throw();
+    });
+  });
+
+  describe("#verifyBatchAsync", () => {
+    it("should resolve to an array of booleans", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const publicKey = signature.generateKeypair();
+      const messages = [0, 1, 2].map((i) => Buffer.alloc(48, `TCosmo${i}`));
+      const signatures = messages.map((message) => signature.sign(message));
+      signatures[1] = signatures[0];
+      const output = await signature.verifyBatchAsync(messages, signatures, publicKey);
+      expect(output).to.deep.equal([true, false, true]);
+    });
+  });
+
+  describe("#verifyAll", () => {
+    const algorithms = Sigs.getEnabledAlgorithms();
+    const signature = new Signature(algorithms[0]);
+    const publicKey = signature.generateKeypair();
+    const messages = [0, 1, 2, 3].map((i) => Buffer.alloc(48, `TCosmo${i}`));
+    const signatures = messages.map((message) => signature.sign(message));
+
+    it("should return true when every signature is valid", () => {
+      expect(signature.verifyAll(messages, signatures, publicKey)).to.be.true;
+    });
+    it("should return false when any signature is invalid", () => {
+      const badSignatures = [...signatures].reverse();
+      expect(signature.verifyAll(messages, badSignatures, publicKey)).to.be.false;
+    });
+    it("should resolve asynchronously", async () => {
+      expect(await signature.verifyAllAsync(messages, signatures, publicKey)).to.be.true;
+    });
+  });
+
+  describe("#createSigner", () => {
+    const algorithms = Sigs.getEnabledAlgorithms();
+    const signature = new Signature(algorithms[0]);
+    const publicKey = signature.generateKeypair();
+    const chunks = [0, 1, 2].map((i) => Buffer.alloc(1024, `TCosmo${i}`));
+
+    it("should produce a signature that verifies with a verifier", () => {
+      const signer = signature.createSigner();
+      chunks.forEach((chunk) => signer.update(chunk));
+      const sig = signer.final();
+      const verifier = signature.createVerifier();
+      chunks.forEach((chunk) => verifier.update(chunk));
+      expect(verifier.final(sig, publicKey)).to.be.true;
+    });
+    it("should not depend on how the message is split into chunks", () => {
+      const sig = signature.createSigner().update(Buffer.concat(chunks)).final();
+      const verifier = signature.createVerifier();
+      chunks.forEach((chunk) => verifier.update(chunk));
+      expect(verifier.final(sig, publicKey)).to.be.true;
+    });
+    it("should not verify a different message", () => {
+      const sig = signature.createSigner().update(chunks[0]).final();
+      const verifier = signature.createVerifier().update(chunks[1]);
+      expect(verifier.final(sig, publicKey)).to.be.false;
+    });
+    it("should throw when used after final", () => {
+      const signer = signature.createSigner();
+      signer.final();
+      expect(() => signer.update(chunks[0])).to.throw();
+      expect(() => signer.final()).to.throw();
+    });
+    it("should throw when called with an invalid chunk type", () => {
+      expect(() => signature.createSigner().update("TCosmo")).to.throw(TypeError);
+    });
+    it("should allow final to be retried after signing fails", () => {
+      const unkeyed = new Signature(algorithms[0]);
+      const signer = unkeyed.createSigner().update(chunks[0]);
+      expect(() => signer.final()).to.throw(Error);
+      const unkeyedPublicKey = unkeyed.generateKeypair();
+      const sig = signer.final();
+      expect(unkeyed.createVerifier().update(chunks[0]).final(sig, unkeyedPublicKey)).to.be.true;
+      expect(() => signer.final()).to.throw(Error);
+    });
+  });
+
+  describe("#signFile", () => {
+    const algorithms = Sigs.getEnabledAlgorithms();
+    const signature = new Signature(algorithms[0]);
+    const publicKey = signature.generateKeypair();
+    const contents = Buffer.alloc(3 * 1024 * 1024 + 7, "TCosmo");
+    let directory;
+    let file;
+
+    before(() => {
+      directory = fs.mkdtempSync(path.join(os.tmpdir(), "liboqs-node-"));
+      file = path.join(directory, "message");
+      fs.writeFileSync(file, contents);
+    });
+    after(() => {
+      fs.unlinkSync(file);
+      fs.rmdirSync(directory);
+    });
+
+    it("should produce a signature that verifies with verifyFile", async () => {
+      const sig = await signature.signFile(file);
+      expect(sig).to.be.an.instanceof(Buffer);
+      expect(await signature.verifyFile(file, sig, publicKey)).to.be.true;
+    });
+    it("should produce a signature compatible with createVerifier", async () => {
+      const sig = await signature.signFile(file);
+      const verifier = signature.createVerifier().update(contents);
+      expect(verifier.final(sig, publicKey)).to.be.true;
+    });
+    it("should sign the file directly when prehash is false", async () => {
+      const sig = await signature.signFile(file, {prehash: false});
+      expect(signature.verify(contents, sig, publicKey)).to.be.true;
+      expect(await signature.verifyFile(file, sig, publicKey, {prehash: false})).to.be.true;
+      expect(await signature.verifyFile(file, sig, publicKey)).to.be.false;
+    });
+    it("should sign an empty file", async () => {
+      const empty = path.join(directory, "empty");
+      fs.writeFileSync(empty, Buffer.alloc(0));
+      try {
+        const sig = await signature.signFile(empty);
+        expect(await signature.verifyFile(empty, sig, publicKey)).to.be.true;
+        expect(await signature.verifyFile(file, sig, publicKey)).to.be.false;
+      } finally {
+        fs.unlinkSync(empty);
+      }
+    });
+    it("should not crash when the file is truncated while it is read", async () => {
+      const truncated = path.join(directory, "truncated");
+      fs.writeFileSync(truncated, contents);
+      try {
+        const pending = signature.signFile(truncated);
+        fs.truncateSync(truncated, 1024);
+        expect(await pending).to.be.an.instanceof(Buffer);
+      } finally {
+        fs.unlinkSync(truncated);
+      }
+    });
+    it("should reject when the file can not be read", async () => {
+      let error = null;
+      try {
+        await signature.signFile(path.join(directory, "missing"));
+      } catch (e) {
+        error = e;
+      }
+      expect(error).to.be.an.instanceof(Error);
+      error = null;
+      try {
+        await signature.signFile(directory);
+      } catch (e) {
+        error = e;
+      }
+      expect(error).to.be.an.instanceof(Error);
+    });
+    it("should throw when called with invalid arguments", () => {
+      expect(() => signature.signFile()).to.throw(TypeError);
+      expect(() => signature.signFile(contents)).to.throw(TypeError);
+      expect(() => signature.signFile(file, {prehash: "yes"})).to.throw(TypeError);
+      expect(() => signature.verifyFile(file, "invalid type", publicKey)).to.throw(TypeError);
+      expect(() => signature.verifyFile(file)).to.throw(TypeError);
+    });
+  });
+
+  describe("static #generateKeypairs", () => {
+    it("should return packed keys with a fixed stride", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const details = Sigs.getDetails(algorithms[0]);
+      const batch = Signature.generateKeypairs(algorithms[0], 4);
+      expect(batch.count).to.equal(4);
+      expect(batch.publicKeyLength).to.equal(details.publicKeyLength);
+      expect(batch.secretKeyLength).to.equal(details.secretKeyLength);
+      expect(batch.publicKeys.length).to.equal(4 * details.publicKeyLength);
+      expect(batch.secretKeys.length).to.equal(4 * details.secretKeyLength);
+    });
+    it("should return usable keypairs", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const message = Buffer.from("TCosmo");
+      const {publicKeys, secretKeys, publicKeyLength, secretKeyLength} = Signature.generateKeypairs(algorithms[0], 3);
+      for (let i = 0; i < 3; i++) {
+        const publicKey = publicKeys.subarray(i * publicKeyLength, (i + 1) * publicKeyLength);
+        const secretKey = secretKeys.subarray(i * secretKeyLength, (i + 1) * secretKeyLength);
+        const signature = new Signature(algorithms[0], secretKey).sign(message);
+        expect(new Signature(algorithms[0]).verify(message, signature, publicKey)).to.be.true;
+      }
+    });
+    it("should throw when called with invalid arguments", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      expect(() => Signature.generateKeypairs("invalid algorithm", 1)).to.throw();
+      expect(() => Signature.generateKeypairs(algorithms[0], -1)).to.throw();
+      expect(() => Signature.generateKeypairs(algorithms[0])).to.throw();
+    });
+  });
+
+  describe("static #generateKeypairsAsync", () => {
+    it("should resolve to usable packed keypairs", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const message = Buffer.from("TCosmo");
+      const {publicKeys, secretKeys, publicKeyLength, secretKeyLength} = await Signature.generateKeypairsAsync(algorithms[0], 4);
+      const publicKey = publicKeys.subarray(3 * publicKeyLength);
+      const secretKey = secretKeys.subarray(3 * secretKeyLength);
+      const signature = new Signature(algorithms[0], secretKey).sign(message);
+      expect(new Signature(algorithms[0]).verify(message, signature, publicKey)).to.be.true;
+    });
+  });
+
   describe("integration", () => {
     const algorithms = Sigs.getEnabledAlgorithms();
     const alice = new Signature(algorithms[0]);
@@ -1,7 +1,10 @@
 const {expect} = require("chai")
   .use(require("chai-bytes"));
 
-const {Sigs} = require("../lib/index.js");
+const {
+  Signature,
+  Sigs
+} = require("../lib/index.js");
 
 describe("Sigs", () => {
   describe("static #getEnabledAlgorithms", () => {
@@ -22,6 +25,11 @@ describe("Sigs", () => {
     it("should not throw", () => {
       expect(() => Sigs.getEnabledAlgorithms()).to.not.throw();
     });
+    it("should return the same frozen array every time", () => {
+      const output = Sigs.getEnabledAlgorithms();
+      expect(output).to.be.frozen;
+      expect(Sigs.getEnabledAlgorithms()).to.equal(output);
+    });
   });
 
   describe("static #isAlgorithmEnabled", () => {
@@ -39,4 +47,30 @@ describe("Sigs", () => {
       expect(() => Sigs.isAlgorithmEnabled()).to.throw();
     });
   });
+
+  describe("static #getDetails", () => {
+    it("should return the same details as an instance", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      for (const algorithm of algorithms) {
+        const instance = new Signature(algorithm);
+        expect(Sigs.getDetails(algorithm)).to.deep.equal(instance.getDetails());
+      }
+    });
+    it("should return the same frozen object every time", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const output = Sigs.getDetails(algorithms[0]);
+      expect(output).to.be.frozen;
+      expect(Sigs.getDetails(algorithms[0])).to.equal(output);
+      expect(new Signature(algorithms[0]).getDetails()).to.equal(output);
+    });
+    it("should throw when called with an invalid algorithm", () => {
+      expect(() => Sigs.getDetails("invalid algorithm")).to.throw();
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => Sigs.getDetails(123)).to.throw();
+    });
+    it("should throw when called without arguments", () => {
+      expect(() => Sigs.getDetails()).to.throw();
+    });
+  });
 });
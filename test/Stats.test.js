@@ -0,0 +1,74 @@
+const {expect} = require("chai");
+
+const {
+  KEMs,
+  KeyEncapsulation,
+  Signature,
+  Sigs,
+  Stats
+} = require("../lib/index.js");
+
+describe("Stats", () => {
+  afterEach(() => {
+    Stats.setEnabled(false);
+    Stats.resetStats();
+  });
+
+  describe("static #setEnabled", () => {
+    it("should turn recording on and off", () => {
+      Stats.setEnabled(true);
+      expect(Stats.isEnabled()).to.be.true;
+      Stats.setEnabled(false);
+      expect(Stats.isEnabled()).to.be.false;
+    });
+    it("should throw when called with an invalid type", () => {
+      expect(() => Stats.setEnabled(1)).to.throw(TypeError);
+    });
+  });
+
+  describe("static #getStats", () => {
+    it("should count KEM operations", () => {
+      const algorithms = KEMs.getEnabledAlgorithms();
+      Stats.setEnabled(true);
+      const kem = new KeyEncapsulation(algorithms[0]);
+      const details = kem.getDetails();
+      const publicKey = kem.generateKeypair();
+      const {ciphertext} = kem.encapsulateSecret(publicKey);
+      kem.decapsulateSecret(ciphertext);
+      const stats = Stats.getStats().algorithms[algorithms[0]];
+      expect(stats.generateKeypair.calls).to.equal(1);
+      expect(stats.encapsulateSecret.calls).to.equal(1);
+      expect(stats.encapsulateSecret.bytesIn).to.equal(details.publicKeyLength);
+      expect(stats.decapsulateSecret.bytesOut).to.equal(details.sharedSecretLength);
+    });
+    it("should count failures and fill the histogram", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      Stats.setEnabled(true);
+      const signature = new Signature(algorithms[0]);
+      expect(() => signature.sign(Buffer.alloc(8))).to.throw();
+      signature.generateKeypair();
+      signature.sign(Buffer.alloc(8));
+      const {bucketBoundsUs, algorithms: algorithmStats} = Stats.getStats();
+      const stats = algorithmStats[algorithms[0]].sign;
+      expect(stats.calls).to.equal(2);
+      expect(stats.failures).to.equal(1);
+      expect(stats.histogram).to.have.lengthOf(bucketBoundsUs.length + 1);
+      expect(stats.histogram.reduce((sum, count) => sum + count, 0)).to.equal(2);
+    });
+    it("should not record while disabled", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      new Signature(algorithms[0]).generateKeypair();
+      expect(Stats.getStats().algorithms[algorithms[0]]).to.not.have.property("generateKeypair");
+    });
+  });
+
+  describe("static #resetStats", () => {
+    it("should clear the recorded stats", () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      Stats.setEnabled(true);
+      new Signature(algorithms[0]).generateKeypair();
+      Stats.resetStats();
+      expect(Stats.getStats().algorithms[algorithms[0]]).to.deep.equal({});
+    });
+  });
+});
@@ -0,0 +1,67 @@
+const {expect} = require("chai");
+
+const {
+  Signature,
+  Sigs,
+  ThreadPool
+} = require("../lib/index.js");
+
+describe("ThreadPool", () => {
+  const defaults = ThreadPool.getOptions();
+
+  after(() => {
+    ThreadPool.configure(defaults);
+  });
+
+  describe("static #getOptions", () => {
+    it("should return the options in use", () => {
+      const options = ThreadPool.getOptions();
+      expect(options.threads).to.be.a("number").and.at.least(1);
+      expect(options.name).to.be.a("string");
+      expect(options.affinity).to.be.an("array");
+    });
+  });
+
+  describe("static #configure", () => {
+    it("should apply the given options", () => {
+      ThreadPool.configure({threads: 2, name: "oqs-test", affinity: [0]});
+      expect(ThreadPool.getOptions()).to.deep.equal({threads: 2, name: "oqs-test", affinity: [0]});
+    });
+    it("should use defaults for missing options", () => {
+      ThreadPool.configure({threads: 3});
+      const options = ThreadPool.getOptions();
+      expect(options.threads).to.equal(3);
+      expect(options.name).to.equal(defaults.name);
+      expect(options.affinity).to.deep.equal([]);
+    });
+    it("should still run asynchronous operations", async () => {
+      ThreadPool.configure({threads: 1});
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const publicKey = await signature.generateKeypairAsync();
+      const messages = [0, 1, 2, 3].map((i) => Buffer.alloc(48, `TCosmo${i}`));
+      const signatures = await Promise.all(messages.map((message) => signature.signAsync(message)));
+      const results = await signature.verifyBatchAsync(messages, signatures, publicKey);
+      expect(results).to.deep.equal([true, true, true, true]);
+    });
+    it("should finish work queued before it was called", async () => {
+      const algorithms = Sigs.getEnabledAlgorithms();
+      const signature = new Signature(algorithms[0]);
+      const pending = [0, 1, 2, 3].map(() => signature.generateKeypairAsync());
+      ThreadPool.configure({threads: 2});
+      const publicKeys = await Promise.all(pending);
+      expect(publicKeys).to.have.lengthOf(4);
+    });
+    it("should throw when called with an invalid thread count", () => {
+      expect(() => ThreadPool.configure({threads: 0})).to.throw(TypeError);
+      expect(() => ThreadPool.configure({threads: 1.5})).to.throw(TypeError);
+    });
+    it("should throw when called with an invalid affinity", () => {
+      expect(() => ThreadPool.configure({affinity: [-1]})).to.throw(TypeError);
+      expect(() => ThreadPool.configure({affinity: 0})).to.throw(TypeError);
+    });
+    it("should throw when called without arguments", () => {
+      expect(() => ThreadPool.configure()).to.throw(TypeError);
+    });
+  });
+});
@@ -0,0 +1,101 @@
+const {expect} = require("chai")
+  .use(require("chai-bytes"));
+
+const path = require("path");
+const {Worker} = require("worker_threads");
+
+const {
+  KEMs,
+  KeyEncapsulation,
+  Random,
+  ThreadPool
+} = require("../lib/index.js");
+
+const workerSource = `
+  const {parentPort, workerData} = require("worker_threads");
+  const {KeyEncapsulation, Signature, Sigs} = require(workerData.index);
+  let ok = true;
+  for (let i = 0; i < 20; i++) {
+    const recipient = new KeyEncapsulation(workerData.algorithm);
+    const {ciphertext, sharedSecret} = new KeyEncapsulation(workerData.algorithm).encapsulateSecret(recipient.generateKeypair());
+    ok = ok && recipient.decapsulateSecret(ciphertext).equals(sharedSecret);
+    const signer = new Signature(Sigs.getEnabledAlgorithms()[0]);
+    const publicKey = signer.generateKeypair();
+    const message = Buffer.from("TCosmo" + i);
+    ok = ok && signer.verify(message, signer.sign(message), publicKey);
+  }
+  parentPort.postMessage(ok);
+`;
+
+const asyncWorkerSource = `
+  const {parentPort, workerData} = require("worker_threads");
+  const {Signature, Sigs} = require(workerData.index);
+  (async () => {
+    const signer = new Signature(Sigs.getEnabledAlgorithms()[0]);
+    const publicKey = await signer.generateKeypairAsync();
+    let ok = true;
+    for (let i = 0; i < 50; i++) {
+      const message = Buffer.from("TCosmo" + i);
+      const signature = await signer.signAsync(message);
+      ok = ok && await signer.verifyAsync(message, signature, publicKey);
+    }
+    parentPort.postMessage(ok);
+  })();
+`;
+
+function runWorker(algorithm, source = workerSource) {
+  return new Promise((resolve, reject) => {
+    const worker = new Worker(source, {
+      eval: true,
+      workerData: {
+        algorithm,
+        index: path.join(__dirname, "../lib/index.js")
+      }
+    });
+    worker.once("message", resolve);
+    worker.once("error", reject);
+  });
+}
+
+describe("worker_threads", () => {
+  it("should run operations in several workers at once", async () => {
+    const algorithms = KEMs.getEnabledAlgorithms();
+    const results = await Promise.all([0, 1, 2, 3].map(() => runWorker(algorithms[0])));
+    expect(results.every((ok) => ok)).to.be.true;
+  });
+  it("should keep the classes of the main thread working after workers load the addon", async () => {
+    const algorithms = KEMs.getEnabledAlgorithms();
+    await runWorker(algorithms[0]);
+    const recipient = new KeyEncapsulation(algorithms[0]);
+    const {ciphertext, sharedSecret} = new KeyEncapsulation(algorithms[0]).encapsulateSecret(recipient.generateKeypair());
+    expect(recipient.decapsulateSecret(ciphertext)).to.equalBytes(sharedSecret);
+  });
+  it("should settle async jobs submitted by workers while the thread pool is reconfigured", async () => {
+    const algorithms = KEMs.getEnabledAlgorithms();
+    const defaults = ThreadPool.getOptions();
+    const workers = [0, 1].map(() => runWorker(algorithms[0], asyncWorkerSource));
+    let settled = false;
+    const markSettled = () => {
+      settled = true;
+    };
+    Promise.all(workers).then(markSettled, markSettled);
+    try {
+      for (let threads = 1; !settled; threads = threads % 4 + 1) {
+        ThreadPool.configure({threads});
+        await new Promise((resolve) => setImmediate(resolve));
+      }
+      const results = await Promise.all(workers);
+      expect(results.every((ok) => ok)).to.be.true;
+    } finally {
+      ThreadPool.configure(defaults);
+    }
+  });
+  it("should allow switching the RNG algorithm while workers are running", async () => {
+    const algorithms = KEMs.getEnabledAlgorithms();
+    const workers = [0, 1].map(() => runWorker(algorithms[0]));
+    Random.switchAlgorithm("OpenSSL");
+    Random.switchAlgorithm("system");
+    const results = await Promise.all(workers);
+    expect(results.every((ok) => ok)).to.be.true;
+  });
+});